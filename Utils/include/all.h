@@ -4,11 +4,30 @@
 #include "logger/Logger.h"
 
 #include "file/File.h"
+#include "file/MappedFile.h"
 
 #include "json/Json.h"
 #include "json/JsonObject.h"
 #include "json/JsonArray.h"
 #include "json/JsonElement.h"
+#include "json/JsonKey.h"
+#include "json/JsonKeyPool.h"
 #include "json/JsonParser.h"
+#include "json/IJsonHandler.h"
+#include "json/JsonPushParser.h"
+#include "json/JsonLinesReader.h"
+#include "json/JsonDocument.h"
+#include "json/JsonView.h"
+#include "json/JsonTape.h"
+#include "json/JsonLazy.h"
+#include "json/JsonSerializer.h"
+#include "json/JsonWriter.h"
+#include "json/JsonPointer.h"
+#include "json/JsonPath.h"
+#include "json/JsonProjection.h"
+#include "json/JsonBinding.h"
+#include "json/JsonBinary.h"
+#include "json/JsonSnapshot.h"
+#include "json/JsonPatch.h"
 
 
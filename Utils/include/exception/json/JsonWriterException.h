@@ -0,0 +1,11 @@
+#pragma once
+
+#include "exception/ExceptionInclude.h"
+
+namespace r_utils
+{
+	namespace exception
+	{
+		DEFINE_EXCEPTION(JsonWriterException)
+	} // exception
+} // r_utils
\ No newline at end of file
@@ -36,6 +36,10 @@ namespace r_utils
 
 			/**
 			 * @brief Reads the entire contents of the file.
+			 *
+			 * The file is read directly into a buffer sized from the file system,
+			 * so the contents are copied only once.
+			 *
 			 * @return The file contents as a std::string.
 			 * @throws r_utils::exception::FileException if the file cannot be opened.
 			 */
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "file/File.h"
+
+namespace r_utils
+{
+	namespace io
+	{
+
+		/**
+		 * @brief Maps a file read-only into memory.
+		 *
+		 * The contents are paged in by the operating system on first access instead of
+		 * being read up front, and processes mapping the same file share the pages.
+		 * The mapping is released when the object is destroyed.
+		 *
+		 * Uses mmap on POSIX systems and CreateFileMapping on Windows.
+		 */
+		class MappedFile
+		{
+		public:
+			/**
+			 * @brief Expected access pattern, passed to the OS as a read-ahead hint.
+			 */
+			enum class Access
+			{
+				Random,    /**< No particular order */
+				Sequential /**< Read once from start to end (MADV_SEQUENTIAL) */
+			};
+
+			/**
+			 * @brief Maps the whole file.
+			 * @param file The file to map.
+			 * @param access Expected access pattern.
+			 * @throws r_utils::exception::FileException if the file cannot be opened or mapped.
+			 */
+			explicit MappedFile(const File& file, Access access = Access::Random);
+
+			/** @brief Unmaps the file. */
+			~MappedFile();
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile(MappedFile&& other) noexcept;
+			MappedFile& operator=(MappedFile&& other) noexcept;
+
+			/** @brief Returns the start of the mapping, or nullptr for an empty file. */
+			[[nodiscard]] const char* getData() const;
+			/** @brief Returns the size of the file in bytes. */
+			[[nodiscard]] size_t getSize() const;
+			/** @brief Returns the contents as a view; valid as long as the mapping exists. */
+			[[nodiscard]] std::string_view getView() const;
+
+		private:
+			/** @brief Unmaps the file and closes all handles. */
+			void release();
+
+			const char* data = nullptr;
+			size_t size = 0;
+#ifdef _WIN32
+			void* fileHandle = nullptr;
+			void* mappingHandle = nullptr;
+#endif
+		};
+	} // io
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class IJsonHandler
+		 * @brief Receives parse events from JsonParser instead of a JsonElement tree.
+		 *
+		 * Events arrive in document order. Keys and strings are passed as views that are
+		 * only valid for the duration of the call; copy them if they are needed later.
+		 * All callbacks default to doing nothing, so a handler only overrides what it needs.
+		 * Throwing from a callback aborts parsing.
+		 */
+		class IJsonHandler
+		{
+		public:
+			virtual ~IJsonHandler() = default;
+
+			/** @brief Called for '{'. */
+			virtual void onStartObject() {}
+			/** @brief Called for every member key of the current object. */
+			virtual void onKey(std::string_view /*key*/) {}
+			/** @brief Called for '}'. */
+			virtual void onEndObject() {}
+
+			/** @brief Called for '['. */
+			virtual void onStartArray() {}
+			/** @brief Called for ']'. */
+			virtual void onEndArray() {}
+
+			/** @brief Called for a string value. */
+			virtual void onString(std::string_view /*value*/) {}
+			/** @brief Called for a number with a fraction or exponent, or an integer beyond the 64-bit range. */
+			virtual void onNumber(double /*value*/) {}
+			/** @brief Called for an integral number that fits into an int. Forwards to onNumber() by default. */
+			virtual void onInt(int value) { onNumber(value); }
+			/**
+			 * @brief Called for an integral number that does not fit into an int but into an int64_t.
+			 * Forwards to onNumber() by default, which rounds values beyond 2^53.
+			 */
+			virtual void onInt64(int64_t value) { onNumber(static_cast<double>(value)); }
+			/** @brief Called for an integral number above INT64_MAX that fits into a uint64_t. Forwards to onNumber() by default. */
+			virtual void onUint64(uint64_t value) { onNumber(static_cast<double>(value)); }
+			/** @brief Called for true or false. */
+			virtual void onBoolean(bool /*value*/) {}
+			/** @brief Called for null. */
+			virtual void onNull() {}
+		};
+	} // json
+} // r_utils
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <iostream>
+#include <string_view>
 
 #include "json/JsonElement.h"
 #include "json/JsonObject.h"
 #include "json/JsonParser.h"
+#include "json/JsonLazy.h"
+#include "json/JsonDocument.h"
 #include "file/File.h"
 
 namespace r_utils
@@ -36,11 +39,14 @@ namespace r_utils
 
             /**
              * @brief Parses a JSON-formatted string into a Json instance.
+             *
+             * The input is parsed in place without being copied.
+             *
              * @param input The input string containing JSON data.
              * @return A Json object representing the parsed data.
              * @throws r_utils::exception::JsonParserException on parse errors.
              */
-            static Json parse(const std::string& input);
+            static Json parse(std::string_view input);
 
             /**
              * @brief Parses JSON content from a file into a Json instance.
@@ -50,6 +56,39 @@ namespace r_utils
              */
             static Json parse(const r_utils::io::File& file);
 
+            /**
+             * @brief Indexes a JSON string for on-demand access.
+             *
+             * Only the structure is validated up front. Values are parsed when they are
+             * accessed, and subtrees that are never accessed are skipped entirely.
+             *
+             * @param input The input string containing JSON data. Must outlive the returned document.
+             * @return A lazy document over the input.
+             * @throws r_utils::exception::JsonParserException if the brackets do not match or content follows the root value.
+             */
+            static JsonLazyDocument parseLazy(std::string_view input);
+
+            /**
+             * @brief Reads a JSON file and indexes it for on-demand access.
+             * @param file The File object to read the JSON content from.
+             * @return A lazy document that owns the file contents.
+             * @throws r_utils::exception::JsonParserException if the brackets do not match or content follows the root value.
+             */
+            static JsonLazyDocument parseLazy(const r_utils::io::File& file);
+
+            /**
+             * @brief Parses a large JSON file straight from a memory mapping.
+             *
+             * The file is never copied into memory as a whole: it is mapped read-only for
+             * sequential access, and strings without escape sequences reference the mapping
+             * directly. See JsonDocument::parseMapped.
+             *
+             * @param file The File object to parse.
+             * @return A read-only document that owns the mapping.
+             * @throws r_utils::exception::JsonParserException on parse errors.
+             */
+            static JsonDocument parseMapped(const r_utils::io::File& file);
+
             /**
              * @brief Checks whether the root element is a JSON object.
              * @return True if the root element is an object, false otherwise.
@@ -62,19 +101,31 @@ namespace r_utils
              */
             [[nodiscard]] bool isArray() const;
 
+            /**
+             * @brief Returns the root element, e.g. to evaluate a JsonPointer or JsonPath against it.
+             * @return Reference to the root element.
+             */
+            const JsonElement& getRoot() const;
+            /** @copydoc getRoot() const */
+            JsonElement& getRoot();
+
             /**
              * @brief Converts the root element to a JsonObject.
-             * @return The root element as a JsonObject.
+             * @return Reference to the root element as a JsonObject.
              * @throws r_utils::exception::JsonElementException if the root is not an object.
              */
-            JsonObject asObject() const;
+            const JsonObject& asObject() const;
+            /** @copydoc asObject() const */
+            JsonObject& asObject();
 
             /**
              * @brief Converts the root element to a JsonArray.
-             * @return The root element as a JsonArray.
+             * @return Reference to the root element as a JsonArray.
              * @throws r_utils::exception::JsonElementException if the root is not an array.
              */
-            JsonArray asArray() const;
+            const JsonArray& asArray() const;
+            /** @copydoc asArray() const */
+            JsonArray& asArray();
 
             /**
              * @brief Converts the JSON value to a string representation.
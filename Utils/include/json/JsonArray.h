@@ -3,6 +3,7 @@
 #include <vector>
 #include <iostream>
 #include <sstream>
+#include <utility>
 
 
 namespace r_utils
@@ -31,6 +32,19 @@ namespace r_utils
              * @return Reference to the current JsonArray (for method chaining).
              */
             r_utils::json::JsonArray& add(const r_utils::json::JsonElement& element);
+            /** @copydoc add(const r_utils::json::JsonElement&) */
+            r_utils::json::JsonArray& add(r_utils::json::JsonElement&& element);
+
+            /**
+             * @brief Constructs an element in place at the end of the array.
+             * @param args Arguments for one of the JsonElement constructors.
+             * @return Reference to the new element.
+             */
+            template<typename... Args>
+            r_utils::json::JsonElement& emplace(Args&&... args)
+            {
+                return values.emplace_back(std::forward<Args>(args)...);
+            }
 
             /**
              * @brief Removes an element from the JSON array.
@@ -39,6 +53,25 @@ namespace r_utils
              */
             r_utils::json::JsonArray& remove(const r_utils::json::JsonElement& element);
 
+            /**
+             * @brief Inserts an element before the given position.
+             * @param index Position of the new element; size() appends.
+             * @param element The JsonElement to insert.
+             * @return Reference to the current JsonArray (for method chaining).
+             * @throws JsonArrayException if the index is greater than size().
+             */
+            r_utils::json::JsonArray& insert(int index, const r_utils::json::JsonElement& element);
+            /** @copydoc insert(int, const r_utils::json::JsonElement&) */
+            r_utils::json::JsonArray& insert(int index, r_utils::json::JsonElement&& element);
+
+            /**
+             * @brief Removes the element at the given position.
+             * @param index The zero-based index of the element.
+             * @return Reference to the current JsonArray (for method chaining).
+             * @throws JsonArrayException if the index is invalid.
+             */
+            r_utils::json::JsonArray& removeAt(int index);
+
             /**
              * @brief Accesses an element by its index.
              * @param index The zero-based index of the element.
@@ -46,10 +79,18 @@ namespace r_utils
              * @throws std::out_of_range if the index is invalid.
              */
             const r_utils::json::JsonElement& get(int index) const;
+            /** @copydoc get(int) const */
+            r_utils::json::JsonElement& get(int index);
 
             size_t size() const;
             bool empty() const;
 
+            /**
+             * @brief Reserves storage for at least the given number of elements.
+             * @param capacity Number of elements the array can hold without reallocating.
+             */
+            void reserve(size_t capacity);
+
             /**
              * @brief Returns all elements of the JSON array as a vector.
              * @return Constant reference to the internal vector of JsonElement objects.
@@ -64,6 +105,8 @@ namespace r_utils
              * @return Constant reference to the JsonElement at the given index.
              */
             const r_utils::json::JsonElement& operator[](int index) const;
+            /** @copydoc operator[](int) const */
+            r_utils::json::JsonElement& operator[](int index);
 
         private:
             std::vector<r_utils::json::JsonElement> values;
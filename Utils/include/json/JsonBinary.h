@@ -0,0 +1,113 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "json/JsonElement.h"
+#include "json/IJsonHandler.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonCbor
+		 * @brief Converts JSON values to and from CBOR (RFC 8949).
+		 *
+		 * Encoding uses definite lengths and the shortest form of every integer, and
+		 * writes a double as a 32-bit float when that loses nothing. Decoding accepts
+		 * definite and indefinite lengths, half, single and double precision floats and
+		 * skips tags. Byte strings are decoded as strings, undefined as null.
+		 *
+		 * The stream overloads read and write one value at a time, so consecutive values
+		 * can be read from the same stream until it ends.
+		 */
+		class JsonCbor
+		{
+		public:
+			/** @brief Encodes a value into a byte string. */
+			static std::string encode(const JsonElement& element);
+			/** @copydoc encode(const JsonElement&) */
+			static std::string encode(const JsonObject& object);
+			/** @copydoc encode(const JsonElement&) */
+			static std::string encode(const JsonArray& array);
+
+			/**
+			 * @brief Encodes a value into a stream, 64 KiB at a time.
+			 * @throws JsonWriterException if the stream reports an error.
+			 */
+			static void encode(const JsonElement& element, std::ostream& out);
+			/** @copydoc encode(const JsonElement&, std::ostream&) */
+			static void encode(const JsonObject& object, std::ostream& out);
+			/** @copydoc encode(const JsonElement&, std::ostream&) */
+			static void encode(const JsonArray& array, std::ostream& out);
+
+			/**
+			 * @brief Decodes one value.
+			 * @throws JsonParserException if the data is truncated or not supported.
+			 */
+			static JsonElement decode(std::string_view data);
+			/** @brief Decodes the next value from a stream, leaving the stream right after it. */
+			static JsonElement decode(std::istream& in);
+
+			/**
+			 * @brief Decodes one value and reports it as events, like JsonParser::parse.
+			 *
+			 * Integers beyond the int range are reported exactly through onInt64() or onUint64().
+			 */
+			static void decode(std::string_view data, IJsonHandler& handler);
+			/** @copydoc decode(std::string_view, IJsonHandler&) */
+			static void decode(std::istream& in, IJsonHandler& handler);
+		};
+
+		/**
+		 * @class JsonMessagePack
+		 * @brief Converts JSON values to and from MessagePack.
+		 *
+		 * Encoding picks the smallest representation of every integer, string and
+		 * container header, and writes a double as float 32 when that loses nothing.
+		 * Decoding reads bin values as strings and rejects extension types.
+		 *
+		 * The stream overloads read and write one value at a time, so consecutive values
+		 * can be read from the same stream until it ends.
+		 */
+		class JsonMessagePack
+		{
+		public:
+			/** @brief Encodes a value into a byte string. */
+			static std::string encode(const JsonElement& element);
+			/** @copydoc encode(const JsonElement&) */
+			static std::string encode(const JsonObject& object);
+			/** @copydoc encode(const JsonElement&) */
+			static std::string encode(const JsonArray& array);
+
+			/**
+			 * @brief Encodes a value into a stream, 64 KiB at a time.
+			 * @throws JsonWriterException if the stream reports an error.
+			 */
+			static void encode(const JsonElement& element, std::ostream& out);
+			/** @copydoc encode(const JsonElement&, std::ostream&) */
+			static void encode(const JsonObject& object, std::ostream& out);
+			/** @copydoc encode(const JsonElement&, std::ostream&) */
+			static void encode(const JsonArray& array, std::ostream& out);
+
+			/**
+			 * @brief Decodes one value.
+			 * @throws JsonParserException if the data is truncated or not supported.
+			 */
+			static JsonElement decode(std::string_view data);
+			/** @brief Decodes the next value from a stream, leaving the stream right after it. */
+			static JsonElement decode(std::istream& in);
+
+			/**
+			 * @brief Decodes one value and reports it as events, like JsonParser::parse.
+			 *
+			 * Integers beyond the int range are reported exactly through onInt64() or onUint64().
+			 */
+			static void decode(std::string_view data, IJsonHandler& handler);
+			/** @copydoc decode(std::string_view, IJsonHandler&) */
+			static void decode(std::istream& in, IJsonHandler& handler);
+		};
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,466 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "json/JsonWriter.h"
+#include "file/File.h"
+
+#include "exception/json/JsonBindingException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @brief A named data member of a bound struct. Created by R_UTILS_JSON_FIELDS.
+		 */
+		template<typename T, typename M>
+		struct JsonField
+		{
+			std::string_view name;
+			M T::* member;
+		};
+
+		struct JsonBindingOps;
+
+		/**
+		 * @brief A value being read: the C++ object and the operations that fill it.
+		 */
+		struct JsonBindingTarget
+		{
+			void* object;
+			/** Operations for the object's type, or nullptr to skip the value. */
+			const JsonBindingOps* ops;
+		};
+
+		/**
+		 * @brief Type-erased operations that fill one C++ type from parse events.
+		 *
+		 * Callbacks left as nullptr mean the JSON type is not accepted; the reader then
+		 * throws JsonBindingException naming the expected type.
+		 */
+		struct JsonBindingOps
+		{
+			/** What the type expects, for error messages, e.g. "a string". */
+			const char* expected;
+
+			void (*onString)(void* object, std::string_view value) = nullptr;
+			void (*onNumber)(void* object, double value) = nullptr;
+			void (*onInt)(void* object, int value) = nullptr;
+			void (*onInt64)(void* object, int64_t value) = nullptr;
+			void (*onUint64)(void* object, uint64_t value) = nullptr;
+			void (*onBoolean)(void* object, bool value) = nullptr;
+			void (*onNull)(void* object) = nullptr;
+			/** Called for '{'; returns the target that receives the keys. */
+			JsonBindingTarget (*onStartObject)(void* object) = nullptr;
+			/** Called for '['; returns the target that receives the elements. */
+			JsonBindingTarget (*onStartArray)(void* object) = nullptr;
+			/** Returns the target for the member with the given key, or one without ops to skip it. */
+			JsonBindingTarget (*onKey)(void* object, std::string_view key) = nullptr;
+			/** Returns the target for the next array element. */
+			JsonBindingTarget (*onElement)(void* object) = nullptr;
+		};
+
+		/**
+		 * @brief Compile-time perfect hash of the field names of a bound struct.
+		 *
+		 * A seed is searched for at compile time so that every name lands in its own
+		 * slot. Looking up a key at runtime then costs one hash and one comparison.
+		 */
+		template<size_t N>
+		struct JsonFieldTable
+		{
+			static constexpr size_t SIZE = std::bit_ceil(N * 4);
+			static constexpr uint8_t EMPTY = 0xFF;
+
+			static constexpr uint32_t hash(std::string_view key, uint32_t seed)
+			{
+				uint32_t h = 2166136261u ^ seed;
+				for (char c : key)
+				{
+					h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+				}
+				return h ^ (h >> 15);
+			}
+
+			constexpr explicit JsonFieldTable(const std::array<std::string_view, N>& names)
+				: names(names)
+			{
+				for (uint32_t candidate = 0; candidate < 100000; ++candidate)
+				{
+					slots.fill(EMPTY);
+					bool collision = false;
+					for (size_t i = 0; i < N && !collision; ++i)
+					{
+						uint8_t& slot = slots[hash(names[i], candidate) & (SIZE - 1)];
+						collision = slot != EMPTY;
+						slot = static_cast<uint8_t>(i);
+					}
+					if (!collision)
+					{
+						seed = candidate;
+						valid = true;
+						return;
+					}
+				}
+			}
+
+			/** @brief Returns the index of the field with the given name, or N. */
+			constexpr size_t find(std::string_view key) const
+			{
+				const uint8_t slot = slots[hash(key, seed) & (SIZE - 1)];
+				return slot != EMPTY && names[slot] == key ? slot : N;
+			}
+
+			std::array<std::string_view, N> names;
+			std::array<uint8_t, SIZE> slots{};
+			uint32_t seed = 0;
+			bool valid = false;
+		};
+
+		/**
+		 * @brief Satisfied by structs that were bound with R_UTILS_JSON_FIELDS.
+		 */
+		template<typename T>
+		concept JsonBindable = requires { rUtilsJsonFields(static_cast<const T*>(nullptr)); };
+
+		/**
+		 * @brief Reads and writes one C++ type. Specialized for booleans, numbers,
+		 * std::string, std::vector, std::optional and bound structs.
+		 */
+		template<typename T>
+		struct JsonBinder;
+
+		template<>
+		struct JsonBinder<bool>
+		{
+			static void onBoolean(void* object, bool value) { *static_cast<bool*>(object) = value; }
+
+			static constexpr JsonBindingOps ops{ .expected = "a boolean", .onBoolean = &onBoolean };
+
+			static void write(JsonWriter& writer, bool value) { writer.value(value); }
+		};
+
+		template<typename T>
+			requires std::integral<T> && (!std::same_as<T, bool>)
+		struct JsonBinder<T>
+		{
+			static void onInt(void* object, int value) { assign(object, value); }
+			static void onInt64(void* object, int64_t value) { assign(object, value); }
+			static void onUint64(void* object, uint64_t value) { assign(object, value); }
+
+			static void onNumber(void* object, double value)
+			{
+				// Integral literals arrive exactly through onInt/onInt64/onUint64. Doubles are only
+				// accepted if they are integral and small enough not to have been rounded.
+				constexpr double exact = static_cast<double>(uint64_t(1) << std::numeric_limits<double>::digits);
+				if (value != std::trunc(value))
+				{
+					throw r_utils::exception::JsonBindingException("Expected an integer, got " + JsonSerializer::serialize(JsonElement(value)));
+				}
+				if (std::fabs(value) >= exact) throwOutOfRange(JsonSerializer::serialize(JsonElement(value)));
+				assign(object, static_cast<int64_t>(value));
+			}
+
+			static constexpr JsonBindingOps ops{ .expected = "an integer", .onNumber = &onNumber, .onInt = &onInt, .onInt64 = &onInt64, .onUint64 = &onUint64 };
+
+			static void write(JsonWriter& writer, T value) { writer.value(value); }
+
+		private:
+			template<std::integral V>
+			static void assign(void* object, V value)
+			{
+				if (!std::in_range<T>(value)) throwOutOfRange(std::to_string(value));
+				*static_cast<T*>(object) = static_cast<T>(value);
+			}
+
+			[[noreturn]] static void throwOutOfRange(const std::string& literal)
+			{
+				throw r_utils::exception::JsonBindingException("Number out of range for an integer field: " + literal);
+			}
+		};
+
+		template<std::floating_point T>
+		struct JsonBinder<T>
+		{
+			static void onNumber(void* object, double value) { *static_cast<T*>(object) = static_cast<T>(value); }
+			static void onInt(void* object, int value) { *static_cast<T*>(object) = static_cast<T>(value); }
+			static void onInt64(void* object, int64_t value) { *static_cast<T*>(object) = static_cast<T>(value); }
+			static void onUint64(void* object, uint64_t value) { *static_cast<T*>(object) = static_cast<T>(value); }
+
+			static constexpr JsonBindingOps ops{ .expected = "a number", .onNumber = &onNumber, .onInt = &onInt, .onInt64 = &onInt64, .onUint64 = &onUint64 };
+
+			static void write(JsonWriter& writer, T value) { writer.value(static_cast<double>(value)); }
+		};
+
+		template<>
+		struct JsonBinder<std::string>
+		{
+			static void onString(void* object, std::string_view value) { static_cast<std::string*>(object)->assign(value); }
+
+			static constexpr JsonBindingOps ops{ .expected = "a string", .onString = &onString };
+
+			static void write(JsonWriter& writer, const std::string& value) { writer.value(value); }
+		};
+
+		template<typename T>
+		struct JsonBinder<std::vector<T>>
+		{
+			static JsonBindingTarget onStartArray(void* object)
+			{
+				static_cast<std::vector<T>*>(object)->clear();
+				return JsonBindingTarget{ object, &ops };
+			}
+
+			static JsonBindingTarget onElement(void* object)
+			{
+				return JsonBindingTarget{ &static_cast<std::vector<T>*>(object)->emplace_back(), &JsonBinder<T>::ops };
+			}
+
+			static constexpr JsonBindingOps ops{ .expected = "an array", .onStartArray = &onStartArray, .onElement = &onElement };
+
+			static void write(JsonWriter& writer, const std::vector<T>& values)
+			{
+				writer.beginArray();
+				for (const T& value : values)
+				{
+					JsonBinder<T>::write(writer, value);
+				}
+				writer.endArray();
+			}
+		};
+
+		template<typename T>
+		struct JsonBinder<std::optional<T>>
+		{
+			static T* engage(void* object) { return &static_cast<std::optional<T>*>(object)->emplace(); }
+
+			static void onString(void* object, std::string_view value) { forward(JsonBinder<T>::ops.onString, object, value); }
+			static void onNumber(void* object, double value) { forward(JsonBinder<T>::ops.onNumber, object, value); }
+			static void onInt(void* object, int value) { forward(JsonBinder<T>::ops.onInt, object, value); }
+			static void onInt64(void* object, int64_t value) { forward(JsonBinder<T>::ops.onInt64, object, value); }
+			static void onUint64(void* object, uint64_t value) { forward(JsonBinder<T>::ops.onUint64, object, value); }
+			static void onBoolean(void* object, bool value) { forward(JsonBinder<T>::ops.onBoolean, object, value); }
+			static void onNull(void* object) { static_cast<std::optional<T>*>(object)->reset(); }
+			static JsonBindingTarget onStartObject(void* object) { return JsonBindingTarget{ engage(object), &JsonBinder<T>::ops }; }
+			static JsonBindingTarget onStartArray(void* object) { return JsonBindingTarget{ engage(object), &JsonBinder<T>::ops }; }
+
+			static constexpr JsonBindingOps ops{
+				.expected = JsonBinder<T>::ops.expected,
+				.onString = JsonBinder<T>::ops.onString ? &onString : nullptr,
+				.onNumber = JsonBinder<T>::ops.onNumber ? &onNumber : nullptr,
+				.onInt = JsonBinder<T>::ops.onInt ? &onInt : nullptr,
+				.onInt64 = JsonBinder<T>::ops.onInt64 ? &onInt64 : nullptr,
+				.onUint64 = JsonBinder<T>::ops.onUint64 ? &onUint64 : nullptr,
+				.onBoolean = JsonBinder<T>::ops.onBoolean ? &onBoolean : nullptr,
+				.onNull = &onNull,
+				.onStartObject = JsonBinder<T>::ops.onStartObject ? &onStartObject : nullptr,
+				.onStartArray = JsonBinder<T>::ops.onStartArray ? &onStartArray : nullptr
+			};
+
+			static void write(JsonWriter& writer, const std::optional<T>& value)
+			{
+				if (value) JsonBinder<T>::write(writer, *value);
+				else writer.value(nullptr);
+			}
+
+		private:
+			template<typename V>
+			static void forward(void (*callback)(void*, V), void* object, V value) { callback(engage(object), value); }
+		};
+
+		/**
+		 * @brief Binds the fields listed with R_UTILS_JSON_FIELDS. Keys are looked up in a
+		 * JsonFieldTable; unknown keys are skipped and missing fields keep their value.
+		 */
+		template<JsonBindable T>
+		struct JsonBinder<T>
+		{
+			static constexpr auto fields = rUtilsJsonFields(static_cast<const T*>(nullptr));
+			static constexpr size_t COUNT = std::tuple_size_v<decltype(fields)>;
+
+			static constexpr JsonFieldTable<COUNT> table = []<size_t... I>(std::index_sequence<I...>) {
+				return JsonFieldTable<COUNT>(std::array<std::string_view, COUNT>{ std::get<I>(fields).name... });
+			}(std::make_index_sequence<COUNT>{});
+			static_assert(table.valid, "Field names of a JSON-bound struct must be unique");
+
+			template<size_t I>
+			static JsonBindingTarget bindField(void* object)
+			{
+				constexpr auto field = std::get<I>(fields);
+				using Member = std::remove_cvref_t<decltype(static_cast<T*>(object)->*field.member)>;
+				return JsonBindingTarget{ &(static_cast<T*>(object)->*field.member), &JsonBinder<Member>::ops };
+			}
+
+			static constexpr std::array<JsonBindingTarget (*)(void*), COUNT> binders = []<size_t... I>(std::index_sequence<I...>) {
+				return std::array<JsonBindingTarget (*)(void*), COUNT>{ &bindField<I>... };
+			}(std::make_index_sequence<COUNT>{});
+
+			static JsonBindingTarget onStartObject(void* object) { return JsonBindingTarget{ object, &ops }; }
+
+			static JsonBindingTarget onKey(void* object, std::string_view key)
+			{
+				const size_t index = table.find(key);
+				return index < COUNT ? binders[index](object) : JsonBindingTarget{ nullptr, nullptr };
+			}
+
+			static constexpr JsonBindingOps ops{ .expected = "an object", .onStartObject = &onStartObject, .onKey = &onKey };
+
+			static void write(JsonWriter& writer, const T& value)
+			{
+				writer.beginObject();
+				std::apply([&](const auto&... field) {
+					((writer.key(field.name), writeMember(writer, value.*field.member)), ...);
+				}, fields);
+				writer.endObject();
+			}
+
+		private:
+			template<typename M>
+			static void writeMember(JsonWriter& writer, const M& member) { JsonBinder<M>::write(writer, member); }
+		};
+
+		/**
+		 * @class JsonBinding
+		 * @brief Reads and writes C++ structs as JSON without building a JsonElement tree.
+		 *
+		 * Structs are bound by listing their fields with R_UTILS_JSON_FIELDS in the struct's
+		 * namespace. Reading runs on the parser's event interface and writes straight into
+		 * the fields; keys are resolved through a perfect hash computed at compile time.
+		 * Writing goes through JsonWriter. Fields can be booleans, integers, floating-point
+		 * numbers, std::string, std::vector, std::optional (null when empty) and other bound
+		 * structs.
+		 *
+		 * @code
+		 * struct User { std::string name; int age; std::vector<std::string> roles; };
+		 * R_UTILS_JSON_FIELDS(User, name, age, roles)
+		 *
+		 * User user = JsonBinding::parse<User>(R"({"name":"Ada","age":36,"roles":["admin"]})");
+		 * std::string text = JsonBinding::stringify(user);
+		 * @endcode
+		 *
+		 * Integer fields receive integral literals exactly, up to the full 64-bit range.
+		 * Integers written with a fraction or exponent (e.g. 1e3) are accepted below 2^53,
+		 * beyond which they could have been rounded.
+		 */
+		class JsonBinding
+		{
+		public:
+			/**
+			 * @brief Parses JSON text into a new value.
+			 * @throws JsonParserException if the text is not valid JSON.
+			 * @throws JsonBindingException if a value does not match the type of its field.
+			 */
+			template<typename T>
+			static T parse(std::string_view input)
+			{
+				T value{};
+				parse(input, value);
+				return value;
+			}
+
+			/**
+			 * @brief Parses JSON text into an existing value.
+			 *
+			 * Members missing from the input keep their current value; arrays replace the
+			 * contents of vectors.
+			 */
+			template<typename T>
+			static void parse(std::string_view input, T& value)
+			{
+				read(input, JsonBindingTarget{ &value, &JsonBinder<T>::ops });
+			}
+
+			/** @brief Parses a JSON file into an existing value. */
+			template<typename T>
+			static void parse(const r_utils::io::File& file, T& value)
+			{
+				read(file, JsonBindingTarget{ &value, &JsonBinder<T>::ops });
+			}
+
+			/** @brief Writes a value to a JsonWriter, e.g. as one element of a larger document. */
+			template<typename T>
+			static void write(JsonWriter& writer, const T& value)
+			{
+				JsonBinder<T>::write(writer, value);
+			}
+
+			/** @brief Serializes a value to a JSON string. */
+			template<typename T>
+			static std::string stringify(const T& value, bool prettyPrint = false)
+			{
+				std::ostringstream out;
+				{
+					JsonWriter writer(out, prettyPrint);
+					JsonBinder<T>::write(writer, value);
+				}
+				return std::move(out).str();
+			}
+
+		private:
+			static void read(std::string_view input, JsonBindingTarget root);
+			static void read(const r_utils::io::File& file, JsonBindingTarget root);
+		};
+	} // json
+} // r_utils
+
+/**
+ * @brief Binds the listed data members of Type to JSON members of the same name.
+ *
+ * Use it once per struct, at namespace scope in the namespace of the struct, with up
+ * to 32 members.
+ */
+#define R_UTILS_JSON_FIELDS(Type, ...) \
+	[[maybe_unused]] constexpr auto rUtilsJsonFields(const Type*) \
+	{ \
+		return std::make_tuple(R_UTILS_JSON_FIELDS_EACH(Type, __VA_ARGS__)); \
+	}
+
+#define R_UTILS_JSON_EXPAND(x) x
+#define R_UTILS_JSON_FIELD(Type, name) r_utils::json::JsonField<Type, decltype(Type::name)>{ #name, &Type::name }
+#define R_UTILS_JSON_FIELDS_1(Type, a) R_UTILS_JSON_FIELD(Type, a)
+#define R_UTILS_JSON_FIELDS_2(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_1(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_3(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_2(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_4(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_3(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_5(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_4(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_6(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_5(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_7(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_6(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_8(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_7(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_9(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_8(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_10(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_9(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_11(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_10(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_12(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_11(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_13(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_12(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_14(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_13(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_15(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_14(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_16(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_15(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_17(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_16(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_18(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_17(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_19(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_18(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_20(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_19(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_21(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_20(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_22(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_21(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_23(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_22(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_24(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_23(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_25(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_24(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_26(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_25(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_27(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_26(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_28(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_27(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_29(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_28(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_30(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_29(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_31(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_30(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_32(Type, a, ...) R_UTILS_JSON_FIELD(Type, a), R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_31(Type, __VA_ARGS__))
+#define R_UTILS_JSON_FIELDS_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, name, ...) name
+#define R_UTILS_JSON_FIELDS_EACH(Type, ...) R_UTILS_JSON_EXPAND(R_UTILS_JSON_FIELDS_SELECT(__VA_ARGS__, R_UTILS_JSON_FIELDS_32, R_UTILS_JSON_FIELDS_31, R_UTILS_JSON_FIELDS_30, R_UTILS_JSON_FIELDS_29, R_UTILS_JSON_FIELDS_28, R_UTILS_JSON_FIELDS_27, R_UTILS_JSON_FIELDS_26, R_UTILS_JSON_FIELDS_25, R_UTILS_JSON_FIELDS_24, R_UTILS_JSON_FIELDS_23, R_UTILS_JSON_FIELDS_22, R_UTILS_JSON_FIELDS_21, R_UTILS_JSON_FIELDS_20, R_UTILS_JSON_FIELDS_19, R_UTILS_JSON_FIELDS_18, R_UTILS_JSON_FIELDS_17, R_UTILS_JSON_FIELDS_16, R_UTILS_JSON_FIELDS_15, R_UTILS_JSON_FIELDS_14, R_UTILS_JSON_FIELDS_13, R_UTILS_JSON_FIELDS_12, R_UTILS_JSON_FIELDS_11, R_UTILS_JSON_FIELDS_10, R_UTILS_JSON_FIELDS_9, R_UTILS_JSON_FIELDS_8, R_UTILS_JSON_FIELDS_7, R_UTILS_JSON_FIELDS_6, R_UTILS_JSON_FIELDS_5, R_UTILS_JSON_FIELDS_4, R_UTILS_JSON_FIELDS_3, R_UTILS_JSON_FIELDS_2, R_UTILS_JSON_FIELDS_1)(Type, __VA_ARGS__))
\ No newline at end of file
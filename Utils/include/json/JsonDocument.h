@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "json/JsonElement.h"
+#include "file/File.h"
+#include "file/MappedFile.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		struct JsonMember;
+
+		/**
+		 * @class JsonNode
+		 * @brief Read-only JSON value stored inside the arena of a JsonDocument.
+		 *
+		 * Nodes mirror the query API of JsonElement, but strings are returned as views and
+		 * containers as spans into the arena, so reading never copies. A node is only valid
+		 * as long as the JsonDocument that owns it.
+		 */
+		class JsonNode
+		{
+		public:
+			/** Default constructor. Creates a null node. */
+			JsonNode() = default;
+
+			[[nodiscard]] JsonType getType() const;
+
+			[[nodiscard]] bool isNull() const;
+			[[nodiscard]] bool isString() const;
+			[[nodiscard]] bool isInt() const;
+			[[nodiscard]] bool isDouble() const;
+			[[nodiscard]] bool isBoolean() const;
+			[[nodiscard]] bool isArray() const;
+			[[nodiscard]] bool isObject() const;
+
+			/** Returns the node as a string view. Throws if the type does not match. */
+			std::string_view asString() const;
+			/** Returns the node as an integer. Throws if the type does not match. */
+			int asInt() const;
+			/** Returns the node as a double. Throws if the type does not match. */
+			double asDouble() const;
+			/** Returns the node as a boolean. Throws if the type does not match. */
+			bool asBoolean() const;
+
+			/**
+			 * @brief Returns the number of elements or members of an array or object.
+			 * @throws JsonElementException if the node is not a container.
+			 */
+			[[nodiscard]] size_t size() const;
+
+			/** Returns the elements of an array. Throws if the type does not match. */
+			std::span<const JsonNode> getElements() const;
+			/** Returns the members of an object in document order. Throws if the type does not match. */
+			std::span<const JsonMember> getMembers() const;
+
+			/**
+			 * @brief Accesses an array element by index.
+			 * @throws JsonArrayException if the index is out of range.
+			 */
+			const JsonNode& operator[](size_t index) const;
+
+			/**
+			 * @brief Checks if an object contains a key.
+			 * @throws JsonElementException if the node is not an object.
+			 */
+			bool contains(std::string_view key) const;
+
+			/**
+			 * @brief Retrieves an object member by key.
+			 * @throws JsonObjectException if the key does not exist.
+			 */
+			const JsonNode& get(std::string_view key) const;
+
+			/**
+			 * @brief Copies the node and all of its children into a JsonElement tree.
+			 * @return A JsonElement that no longer depends on the document.
+			 */
+			JsonElement toElement() const;
+
+		private:
+			friend class JsonDocumentBuilder;
+
+			JsonType type = JsonType::Null;
+			uint32_t length = 0;
+			union
+			{
+				int intValue;
+				double doubleValue;
+				bool boolValue;
+				const char* string = nullptr;
+				const JsonNode* elements;
+				const JsonMember* members;
+			};
+		};
+
+		/**
+		 * @brief One key-value pair of an object node.
+		 */
+		struct JsonMember
+		{
+			std::string_view key;
+			JsonNode value;
+		};
+
+		/**
+		 * @class JsonDocument
+		 * @brief A parsed JSON document whose nodes, keys and strings live in one arena.
+		 *
+		 * All memory for a document is taken from a monotonic arena in a few large
+		 * blocks and released at once when the document is destroyed, instead of one
+		 * heap allocation per string, array and object as with JsonElement.
+		 * Documents are move-only; moving keeps all nodes at their address.
+		 */
+		class JsonDocument
+		{
+		public:
+			JsonDocument(JsonDocument&& other) noexcept = default;
+			JsonDocument& operator=(JsonDocument&& other) noexcept = default;
+
+			/**
+			 * @brief Parses a JSON string into an arena-backed document.
+			 * @param input JSON text to parse. Does not have to outlive the document.
+			 * @return The parsed document.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonDocument parse(std::string_view input);
+
+			/**
+			 * @brief Parses a JSON file into an arena-backed document.
+			 * @param file File object containing JSON data.
+			 * @return The parsed document.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonDocument parse(const r_utils::io::File& file);
+
+			/**
+			 * @brief Parses a JSON file directly from a read-only memory mapping.
+			 *
+			 * The file is mapped with a sequential access hint instead of being read into
+			 * a buffer, and the document keeps the mapping. Keys and strings without escape
+			 * sequences point into the mapping rather than being copied into the arena, so
+			 * peak memory is roughly the nodes plus the pages the OS keeps cached.
+			 *
+			 * @param file File object containing JSON data.
+			 * @return The parsed document.
+			 * @throws JsonParserException if parsing fails.
+			 * @throws r_utils::exception::FileException if the file cannot be mapped.
+			 */
+			static JsonDocument parseMapped(const r_utils::io::File& file);
+
+			/** @brief Returns the root node of the document. */
+			[[nodiscard]] const JsonNode& getRoot() const;
+
+		private:
+			/** @brief Creates an empty document with an arena sized for the given input. */
+			explicit JsonDocument(size_t inputSize);
+
+			std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+			/** Input that strings of a mapped document point into. */
+			std::optional<r_utils::io::MappedFile> mapping;
+			JsonNode root;
+		};
+	} // json
+} // r_utils
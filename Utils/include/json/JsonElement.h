@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <variant>
 
@@ -33,6 +35,11 @@ namespace r_utils {
 
         /**
          * @brief Compares two JsonElements for equality.
+         *
+         * Elements that share their value are equal without a visit, and arrays and
+         * objects are compared child by child without being copied. The cached
+         * JsonElement::hash is not consulted, so the result is always structural.
+         *
          * @param x First JsonElement.
          * @param y Second JsonElement.
          * @return True if elements are equal, false otherwise.
@@ -54,6 +61,23 @@ namespace r_utils {
          * JsonElement is the core building block for JSON handling. It stores a single
          * value of one of the supported JSON types and provides methods to query its type,
          * convert to a string, and extract the underlying value.
+         *
+         * An element is 16 bytes: a type tag and an 8-byte payload. Numbers and booleans
+         * are stored inline; strings, arrays and objects are owned through a pointer, so
+         * moving an element never touches its contents.
+         *
+         * Strings and containers are copy-on-write: copying an element only increments
+         * a reference count, so copies share their children. The mutable accessors
+         * detach a shared value by copying it one level deep (the children are shared
+         * again), which makes a change through `root.asObject().get("a").asArray()[0]`
+         * make a shallow copy of each container on the path to the changed value. The
+         * first change after a snapshot therefore costs the sum of the widths of those
+         * containers rather than the size of the whole document; an edit in a flat array
+         * of n elements still copies n element handles.
+         *
+         * @note Do not keep a reference from a mutable accessor across a copy of the
+         * element: writes through it would be visible in the copy. Reference counts are
+         * atomic, so copies may be read and modified on different threads.
          */
         class JsonElement
         {
@@ -62,6 +86,7 @@ namespace r_utils {
             JsonElement();
             /** Constructs a JSON string element. */
             JsonElement(const std::string& value);
+            JsonElement(std::string&& value);
             JsonElement(const char* value);
             /** Constructs a JSON integer element. */
             JsonElement(int value);
@@ -73,13 +98,27 @@ namespace r_utils {
             JsonElement(nullptr_t value);
             /** Constructs a JSON array element. */
             JsonElement(const r_utils::json::JsonArray& value);
+            JsonElement(r_utils::json::JsonArray&& value);
             /** Constructs a JSON object element. */
             JsonElement(const r_utils::json::JsonObject& value);
+            JsonElement(r_utils::json::JsonObject&& value);
+
+            JsonElement(const JsonElement& other);
+            JsonElement(JsonElement&& other) noexcept;
+            JsonElement& operator=(const JsonElement& other);
+            JsonElement& operator=(JsonElement&& other) noexcept;
+            ~JsonElement();
 
+            /** The variant holding the value of an element. */
+            using Value = std::variant<std::monostate, std::string, int, double, bool, nullptr_t, r_utils::json::JsonObject, r_utils::json::JsonArray>;
 
             [[nodiscard]] JsonType getType() const;
             [[nodiscard]] std::string stringify() const;
-            [[nodiscard]] std::variant<std::monostate, std::string, int, double, bool, nullptr_t, r_utils::json::JsonObject, r_utils::json::JsonArray> getValue() const;
+            /**
+             * @brief Returns a copy of the value as a variant.
+             * @note This copies strings and containers; prefer the asX() accessors.
+             */
+            [[nodiscard]] Value getValue() const;
 
             [[nodiscard]] bool isNull() const;
             [[nodiscard]] bool isString() const;
@@ -89,8 +128,16 @@ namespace r_utils {
             [[nodiscard]] bool isArray() const;
             [[nodiscard]] bool isObject() const;
 
-            /** Returns the element as a string. Throws if the type does not match. */
-            std::string asString() const;
+            /**
+             * @brief Returns the element as a string. Throws if the type does not match.
+             *
+             * The const and mutable overloads of asString(), asArray() and asObject() return
+             * references into the element, so nested lookups such as
+             * `root.asObject().get("a").asObject().get("b")` copy nothing.
+             */
+            const std::string& asString() const;
+            /** Returns a modifiable reference to the string, detaching it if it is shared. Throws if the type does not match. */
+            std::string& asString();
             /** Returns the element as an integer. Throws if the type does not match. */
             int asInt() const;
             /** Returns the element as a double. Throws if the type does not match. */
@@ -98,14 +145,67 @@ namespace r_utils {
             /** Returns the element as a boolean. Throws if the type does not match. */
             bool asBoolean() const;
             /** Returns the element as a JSON array. Throws if the type does not match. */
-            r_utils::json::JsonArray asArray() const;
+            const r_utils::json::JsonArray& asArray() const;
+            /** Returns a modifiable reference to the array, detaching it if it is shared. Throws if the type does not match. */
+            r_utils::json::JsonArray& asArray();
             /** Returns the element as a JSON object. Throws if the type does not match. */
-            r_utils::json::JsonObject asObject() const;
+            const r_utils::json::JsonObject& asObject() const;
+            /** Returns a modifiable reference to the object, detaching it if it is shared. Throws if the type does not match. */
+            r_utils::json::JsonObject& asObject();
+
+            /**
+             * @brief Checks whether two elements share the same string or container.
+             * @return True if both refer to one out-of-line value, which implies they are equal.
+             */
+            [[nodiscard]] bool sharesWith(const JsonElement& other) const;
+
+            /**
+             * @brief Returns a 64-bit hash of the value that is equal for equal elements.
+             *
+             * Object members are combined independently of their order, matching operator==.
+             * The hash of a string, array or object is computed on first use and cached with
+             * the value, so hashing it again, or hashing a copy, is O(1). The mutable
+             * accessors drop the cached hash of every container they pass through.
+             *
+             * @note Writes through a reference that was taken before the element was hashed
+             * bypass the accessors, so hash() may return the old value afterwards; take a new
+             * reference to write after hashing. operator== and JsonPatch::diff do not depend
+             * on the cache and stay correct either way.
+             */
+            [[nodiscard]] uint64_t hash() const;
 
         private:
+            /** A reference-counted out-of-line value. */
+            template <typename T>
+            struct Shared;
+
+            /** @brief Drops this element's reference to the out-of-line payload and makes the element null. */
+            void release();
+
+            /** Inline value, or the shared out-of-line value for strings and containers. */
+            union Payload
+            {
+                int intValue;
+                double doubleValue;
+                bool boolValue;
+                Shared<std::string>* string;
+                Shared<r_utils::json::JsonArray>* array;
+                Shared<r_utils::json::JsonObject>* object;
+            };
+
+            Payload payload;
             JsonType type;
-            std::variant<std::monostate, std::string, int, double, bool, nullptr_t, r_utils::json::JsonObject, r_utils::json::JsonArray> value;
         };
 
     } // json
 } // r_utils
+
+/** @brief Hashes JsonElements with JsonElement::hash, e.g. to deduplicate them in an std::unordered_set. */
+template <>
+struct std::hash<r_utils::json::JsonElement>
+{
+    size_t operator()(const r_utils::json::JsonElement& element) const
+    {
+        return static_cast<size_t>(element.hash());
+    }
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "json/IJsonHandler.h"
+#include "json/JsonElement.h"
+#include "json/JsonKeyPool.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonElementBuilder
+		 * @brief IJsonHandler that assembles parse events into a JsonElement tree.
+		 *
+		 * Feeding the builder the events of one complete JSON value produces the same
+		 * JsonElement that JsonParser::parse would return for it. It is used wherever
+		 * events have to be turned back into a tree, e.g. by JsonPushParser.
+		 */
+		class JsonElementBuilder : public IJsonHandler
+		{
+		public:
+			/** Default constructor. Creates a builder without a result. */
+			JsonElementBuilder() = default;
+
+			/**
+			 * @brief Creates a builder that takes all object keys from a shared pool.
+			 * @param keyPool Pool that interns the keys. Must outlive the builder.
+			 */
+			explicit JsonElementBuilder(JsonKeyPool& keyPool);
+
+			void onStartObject() override;
+			void onKey(std::string_view key) override;
+			void onEndObject() override;
+			void onStartArray() override;
+			void onEndArray() override;
+			void onString(std::string_view value) override;
+			void onNumber(double value) override;
+			void onInt(int value) override;
+			void onBoolean(bool value) override;
+			void onNull() override;
+
+			/**
+			 * @brief Checks whether a complete top-level value has been built.
+			 * @return True if takeResult() can be called.
+			 */
+			[[nodiscard]] bool hasResult() const;
+
+			/**
+			 * @brief Returns the completed value and resets the builder for the next one.
+			 * @return The built JsonElement.
+			 * @throws JsonParserException if no complete value is available.
+			 */
+			JsonElement takeResult();
+
+		private:
+			/**
+			 * @brief A container that is still being filled.
+			 */
+			struct Frame
+			{
+				bool isObject;
+				JsonObject object;
+				JsonArray array;
+				JsonKey key;
+			};
+
+			/** @brief Adds a finished value to the innermost open container, or makes it the result. */
+			void addValue(JsonElement&& value);
+
+			JsonKeyPool* keyPool = nullptr;
+			std::vector<Frame> stack;
+			JsonElement result;
+			bool ready = false;
+		};
+	} // json
+} // r_utils
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonKey
+		 * @brief Immutable key of a JsonObject member.
+		 *
+		 * A key created from a string stores its text inline like a std::string, so short
+		 * keys need no allocation. Keys handed out by a JsonKeyPool instead hold a handle to
+		 * the pooled string, which is shared by every object that uses the same name; two
+		 * keys from the same pool are equal exactly if they point to the same string, which
+		 * comparisons check first.
+		 */
+		class JsonKey
+		{
+		public:
+			/** Default constructor. Creates an empty key. */
+			JsonKey();
+
+			/** Creates a key that stores a copy of the given string inline. */
+			JsonKey(std::string value);
+			JsonKey(std::string_view value);
+			JsonKey(const char* value);
+
+			/** Wraps an existing shared string, e.g. one from a JsonKeyPool. */
+			explicit JsonKey(std::shared_ptr<const std::string> value);
+
+			/** @brief Returns the key as a string. */
+			[[nodiscard]] const std::string& str() const;
+			[[nodiscard]] bool empty() const;
+			[[nodiscard]] size_t size() const;
+
+			operator const std::string&() const;
+			operator std::string_view() const;
+
+			/**
+			 * @brief Checks whether both keys share the same pooled string.
+			 * @return True if the keys are identical; false does not imply that their contents differ.
+			 */
+			[[nodiscard]] bool sameAs(const JsonKey& other) const;
+
+			/*
+			 * The comparisons are hidden friends so that the implicit conversions to JsonKey
+			 * do not take part in comparisons between other string types.
+			 */
+
+			/** Compares two keys, checking for a shared string before comparing contents. */
+			friend bool operator==(const JsonKey& x, const JsonKey& y)
+			{
+				return x.sameAs(y) || x.str() == y.str();
+			}
+
+			friend bool operator==(const JsonKey& x, std::string_view y)
+			{
+				return std::string_view(x.str()) == y;
+			}
+
+			friend bool operator==(const JsonKey& x, const std::string& y)
+			{
+				return x.str() == y;
+			}
+
+			friend bool operator==(const JsonKey& x, const char* y)
+			{
+				return x.str() == y;
+			}
+
+		private:
+			/** The text of an unpooled key, or the string shared through a JsonKeyPool. */
+			std::variant<std::string, std::shared_ptr<const std::string>> value;
+		};
+
+		std::ostream& operator<<(std::ostream& os, const JsonKey& key);
+	} // json
+} // r_utils
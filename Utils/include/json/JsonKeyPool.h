@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "json/JsonKey.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonKeyPool
+		 * @brief Interning table that stores every distinct object key once.
+		 *
+		 * Passing a pool to JsonParser, JsonElementBuilder or JsonLinesReader makes all
+		 * objects they build share one string per distinct key, across documents. Keys
+		 * stay alive as long as the pool or any object using them.
+		 *
+		 * The pool is thread-safe. Lookups of known keys only take a shared lock, so many
+		 * parser threads can use one pool.
+		 */
+		class JsonKeyPool
+		{
+		public:
+			/** Default constructor. Creates an empty pool. */
+			JsonKeyPool() = default;
+
+			JsonKeyPool(const JsonKeyPool&) = delete;
+			JsonKeyPool& operator=(const JsonKeyPool&) = delete;
+
+			/**
+			 * @brief Returns the interned key for the given name, adding it if needed.
+			 * @param key Key name.
+			 * @return A key that shares its string with every other key of the same name from this pool.
+			 */
+			JsonKey intern(std::string_view key);
+
+			/** @brief Returns the number of distinct keys in the pool. */
+			[[nodiscard]] size_t size() const;
+
+			/** @brief Removes all keys from the pool. Keys already handed out stay valid. */
+			void clear();
+
+		private:
+			mutable std::shared_mutex mutex;
+			/** Maps views of the interned strings to the strings themselves. */
+			std::unordered_map<std::string_view, std::shared_ptr<const std::string>> keys;
+		};
+	} // json
+} // r_utils
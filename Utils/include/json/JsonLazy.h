@@ -0,0 +1,228 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonElement.h"
+#include "file/File.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		class JsonLazyArray;
+		class JsonLazyObject;
+		class JsonLazyStructure;
+
+		/**
+		 * @class JsonLazyValue
+		 * @brief A value of a JsonLazyDocument that has not been parsed yet.
+		 *
+		 * A lazy value is a position in the structural index of its document. Scalars are
+		 * parsed when they are read; objects and arrays are walked member by member and
+		 * jump over every nested value that is not asked for. Values are only valid as
+		 * long as their document.
+		 */
+		class JsonLazyValue
+		{
+		public:
+			[[nodiscard]] JsonType getType() const;
+
+			[[nodiscard]] bool isNull() const;
+			[[nodiscard]] bool isString() const;
+			[[nodiscard]] bool isInt() const;
+			[[nodiscard]] bool isDouble() const;
+			[[nodiscard]] bool isBoolean() const;
+			[[nodiscard]] bool isArray() const;
+			[[nodiscard]] bool isObject() const;
+
+			/** Parses and returns the value as a string. Throws if the type does not match. */
+			std::string asString() const;
+			/** Parses and returns the value as an integer. Throws if the type does not match. */
+			int asInt() const;
+			/** Parses and returns the value as a double. Throws if the type does not match. */
+			double asDouble() const;
+			/** Parses and returns the value as a boolean. Throws if the type does not match. */
+			bool asBoolean() const;
+			/** Returns the value as a lazy array. Throws if the type does not match. */
+			JsonLazyArray asArray() const;
+			/** Returns the value as a lazy object. Throws if the type does not match. */
+			JsonLazyObject asObject() const;
+
+			/**
+			 * @brief Parses the value and all of its children into a JsonElement tree.
+			 * @return A JsonElement that no longer depends on the document.
+			 * @throws JsonParserException if the value is malformed.
+			 */
+			JsonElement toElement() const;
+
+			/** @brief Returns the raw JSON text of the value. */
+			[[nodiscard]] std::string_view getRaw() const;
+
+		private:
+			friend class JsonLazyDocument;
+			friend class JsonLazyArray;
+			friend class JsonLazyObject;
+
+			JsonLazyValue(const JsonLazyStructure* structure, size_t token);
+
+			const JsonLazyStructure* structure;
+			size_t token;
+		};
+
+		/**
+		 * @class JsonLazyArray
+		 * @brief An array of a JsonLazyDocument.
+		 *
+		 * Accessing an element walks the array from its start, skipping earlier elements
+		 * without parsing them. Iterate instead of indexing when visiting many elements.
+		 */
+		class JsonLazyArray
+		{
+		public:
+			/**
+			 * @brief Forward iterator over the elements of a lazy array.
+			 */
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = JsonLazyValue;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = JsonLazyValue;
+
+				JsonLazyValue operator*() const;
+				Iterator& operator++();
+				Iterator operator++(int);
+				bool operator==(const Iterator& other) const;
+				bool operator!=(const Iterator& other) const;
+
+			private:
+				friend class JsonLazyArray;
+
+				Iterator(const JsonLazyStructure* structure, size_t token);
+
+				const JsonLazyStructure* structure;
+				size_t token;
+			};
+
+			/** @brief Counts the elements of the array. */
+			[[nodiscard]] size_t size() const;
+			/** @brief Checks whether the array has no elements. */
+			[[nodiscard]] bool empty() const;
+
+			/**
+			 * @brief Returns the element at the given index.
+			 * @throws JsonArrayException if the index is out of bounds.
+			 */
+			JsonLazyValue get(size_t index) const;
+			/** @copydoc get */
+			JsonLazyValue operator[](size_t index) const;
+
+			[[nodiscard]] Iterator begin() const;
+			[[nodiscard]] Iterator end() const;
+
+		private:
+			friend class JsonLazyValue;
+
+			JsonLazyArray(const JsonLazyStructure* structure, size_t token);
+
+			const JsonLazyStructure* structure;
+			size_t token;
+		};
+
+		/**
+		 * @class JsonLazyObject
+		 * @brief An object of a JsonLazyDocument.
+		 *
+		 * Lookups compare keys in document order and skip the values of all other members
+		 * without parsing them.
+		 */
+		class JsonLazyObject
+		{
+		public:
+			/** @brief Counts the members of the object. */
+			[[nodiscard]] size_t size() const;
+			/** @brief Checks whether the object has no members. */
+			[[nodiscard]] bool empty() const;
+			/** @brief Checks whether the object has a member with the given key. */
+			[[nodiscard]] bool contains(std::string_view key) const;
+
+			/**
+			 * @brief Returns the value of the first member with the given key.
+			 * @throws JsonObjectException if the key does not exist.
+			 */
+			JsonLazyValue get(std::string_view key) const;
+			/** @copydoc get */
+			JsonLazyValue operator[](std::string_view key) const;
+
+			/** @brief Returns all keys in document order. */
+			[[nodiscard]] std::vector<std::string> getKeys() const;
+
+		private:
+			friend class JsonLazyValue;
+
+			JsonLazyObject(const JsonLazyStructure* structure, size_t token);
+
+			bool find(std::string_view key, size_t& valueToken) const;
+
+			const JsonLazyStructure* structure;
+			size_t token;
+		};
+
+		/**
+		 * @class JsonLazyDocument
+		 * @brief On-demand JSON document that only parses what is accessed.
+		 *
+		 * Creating the document runs the structural index over the input and matches all
+		 * brackets, which validates the nesting and rejects anything but whitespace after
+		 * the root value. Nothing else is parsed until values are
+		 * read through getRoot(), asObject() or asArray(). Untouched subtrees are skipped
+		 * in a single step using the bracket matches.
+		 *
+		 * The document is move-only. Lazy values stay valid when it is moved.
+		 */
+		class JsonLazyDocument
+		{
+		public:
+			/**
+			 * @brief Indexes a JSON string.
+			 * @param input JSON text. Must outlive the document and all of its values.
+			 * @throws JsonParserException if the input is empty, the brackets do not match or content follows the root value.
+			 */
+			explicit JsonLazyDocument(std::string_view input);
+
+			/**
+			 * @brief Reads and indexes a JSON file. The document keeps the file contents.
+			 * @param file File object containing JSON data.
+			 * @throws JsonParserException if the file does not exist, the brackets do not match or content follows the root value.
+			 */
+			explicit JsonLazyDocument(const r_utils::io::File& file);
+
+			~JsonLazyDocument();
+			JsonLazyDocument(JsonLazyDocument&& other) noexcept;
+			JsonLazyDocument& operator=(JsonLazyDocument&& other) noexcept;
+			JsonLazyDocument(const JsonLazyDocument&) = delete;
+			JsonLazyDocument& operator=(const JsonLazyDocument&) = delete;
+
+			/** @brief Returns the root value. */
+			[[nodiscard]] JsonLazyValue getRoot() const;
+
+			[[nodiscard]] bool isObject() const;
+			[[nodiscard]] bool isArray() const;
+
+			/** @brief Returns the root as a lazy object. Throws if it is not an object. */
+			JsonLazyObject asObject() const;
+			/** @brief Returns the root as a lazy array. Throws if it is not an array. */
+			JsonLazyArray asArray() const;
+
+		private:
+			std::unique_ptr<JsonLazyStructure> structure;
+		};
+	} // json
+} // r_utils
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonElement.h"
+#include "json/JsonKeyPool.h"
+#include "file/File.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonLinesReader
+		 * @brief Parses JSON Lines (NDJSON) input on a pool of worker threads.
+		 *
+		 * The input is cut into batches of whole lines which the workers parse with
+		 * JsonParser in parallel. Results are always delivered in input order; blank
+		 * lines are skipped. Every other line must hold exactly one value: a parse error,
+		 * including content after the value, is reported with its line number. Only a
+		 * bounded number of batches is parsed ahead of the consumer, so the callback
+		 * variants run in memory independent of the record count.
+		 */
+		class JsonLinesReader
+		{
+		public:
+			/**
+			 * @brief Creates a reader.
+			 * @param threadCount Number of worker threads, or 0 to use one per hardware thread.
+			 * @param keyPool Optional pool that interns the keys of all records. Must outlive the reader.
+			 */
+			explicit JsonLinesReader(unsigned int threadCount = 0, JsonKeyPool* keyPool = nullptr);
+
+			/**
+			 * @brief Parses every line of the input.
+			 * @param input JSON Lines text. Must stay alive for the duration of the call.
+			 * @return One JsonElement per non-blank line, in input order.
+			 * @throws JsonParserException if any line fails to parse.
+			 */
+			std::vector<JsonElement> read(std::string_view input) const;
+
+			/**
+			 * @brief Parses every line of a file.
+			 * @param file File containing JSON Lines.
+			 * @return One JsonElement per non-blank line, in input order.
+			 * @throws JsonParserException if the file does not exist or any line fails to parse.
+			 */
+			std::vector<JsonElement> read(const r_utils::io::File& file) const;
+
+			/**
+			 * @brief Parses every line of the input and hands the results to a callback.
+			 *
+			 * The callback runs on the calling thread, once per non-blank line and in input
+			 * order, while the workers keep parsing the following batches.
+			 *
+			 * @param input JSON Lines text. Must stay alive for the duration of the call.
+			 * @param callback Receives each parsed line.
+			 * @throws JsonParserException if any line fails to parse; exceptions thrown by the callback are propagated.
+			 */
+			void read(std::string_view input, const std::function<void(JsonElement)>& callback) const;
+
+			/**
+			 * @brief Parses every line of a file and hands the results to a callback.
+			 * @param file File containing JSON Lines.
+			 * @param callback Receives each parsed line, in input order.
+			 * @throws JsonParserException if the file does not exist or any line fails to parse.
+			 */
+			void read(const r_utils::io::File& file, const std::function<void(JsonElement)>& callback) const;
+
+			/** @brief Returns the number of worker threads used per read. */
+			[[nodiscard]] unsigned int getThreadCount() const;
+
+		private:
+			/** @brief Approximate number of input bytes per batch. */
+			static constexpr size_t BATCH_SIZE = 256 * 1024;
+			/** @brief Number of batches each worker may parse ahead of the consumer. */
+			static constexpr size_t BATCHES_AHEAD = 4;
+
+			unsigned int threadCount;
+			JsonKeyPool* keyPool;
+		};
+	} // json
+} // r_utils
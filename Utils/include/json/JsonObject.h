@@ -1,8 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
-#include <unordered_map>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "json/JsonKey.h"
 
 namespace r_utils {
     namespace json {
@@ -17,9 +23,16 @@ namespace r_utils {
          * JsonObject is a container for named JSON elements. It provides methods to
          * query, insert, update, and remove elements, as well as to convert the object
          * into a string representation or into a Json wrapper object.
+         *
+         * Members are stored contiguously in insertion order, so iteration and
+         * serialization are deterministic and get(int) is O(1). Small objects are searched
+         * linearly; objects with more than INDEX_THRESHOLD members also keep a hash index.
          */
         class JsonObject {
         public:
+            /** A key and its value. */
+            using Member = std::pair<r_utils::json::JsonKey, r_utils::json::JsonElement>;
+
             /** Default constructor. Creates an empty JSON object. */
             JsonObject() = default;
 
@@ -28,23 +41,36 @@ namespace r_utils {
              * @param key Key to search for.
              * @return True if the key exists, false otherwise.
              */
-            bool contains(const std::string& key) const;
+            bool contains(std::string_view key) const;
 
             /**
              * @brief Retrieves a JSON element by key.
              * @param key Key of the element.
-             * @return JsonElement associated with the key.
+             * @return Reference to the JsonElement associated with the key.
              * @throws Exception if the key does not exist.
              */
-            r_utils::json::JsonElement get(const std::string& key) const;
+            const r_utils::json::JsonElement& get(std::string_view key) const;
+            /** @copydoc get(std::string_view) const */
+            r_utils::json::JsonElement& get(std::string_view key);
+
+            /**
+             * @brief Looks up a JSON element by key without throwing.
+             * @param key Key of the element.
+             * @return Pointer to the element, or nullptr if the key does not exist.
+             */
+            const r_utils::json::JsonElement* tryGet(std::string_view key) const;
+            /** @copydoc tryGet(std::string_view) const */
+            r_utils::json::JsonElement* tryGet(std::string_view key);
 
             /**
-             * @brief Retrieves a JSON element by index (order is undefined).
+             * @brief Retrieves a JSON element by its insertion position.
              * @param index Zero-based index.
-             * @return JsonElement at the given index.
+             * @return Reference to the JsonElement at the given index.
              * @throws Exception if the index is out of range.
              */
-            r_utils::json::JsonElement get(const int index) const;
+            const r_utils::json::JsonElement& get(const int index) const;
+            /** @copydoc get(const int) const */
+            r_utils::json::JsonElement& get(const int index);
 
             /**
              * @brief Inserts or updates a key-value pair in the object.
@@ -52,22 +78,47 @@ namespace r_utils {
              * @param value JSON element to associate with the key.
              * @return Reference to this JsonObject for chaining.
              */
-            r_utils::json::JsonObject& set(const std::string& key, const r_utils::json::JsonElement& value);
+            r_utils::json::JsonObject& set(const r_utils::json::JsonKey& key, const r_utils::json::JsonElement& value);
+            /** @copydoc set(const r_utils::json::JsonKey&, const r_utils::json::JsonElement&) */
+            r_utils::json::JsonObject& set(const r_utils::json::JsonKey& key, r_utils::json::JsonElement&& value);
+
+            /**
+             * @brief Constructs an element from the given arguments and inserts or updates it under the key.
+             * @param key Key to insert or update.
+             * @param args Arguments for one of the JsonElement constructors.
+             * @return Reference to the stored element.
+             */
+            template<typename... Args>
+            r_utils::json::JsonElement& emplace(const r_utils::json::JsonKey& key, Args&&... args)
+            {
+                set(key, r_utils::json::JsonElement(std::forward<Args>(args)...));
+                return get(key);
+            }
 
             /**
              * @brief Removes a key-value pair by key.
              * @param key Key to remove.
-             * @throws Exception if the key does not exist.
              */
-            [[noreturn]] void remove(const std::string& key);
+            void remove(std::string_view key);
 
             /**
-             * @brief Returns a const reference to the internal key-value map.
-             * @return Internal unordered_map of JSON elements.
+             * @brief Returns all members in insertion order.
+             * @return Constant reference to the internal member vector.
              */
-            const std::unordered_map<std::string, r_utils::json::JsonElement>& getValues() const;
+            const std::vector<Member>& getValues() const;
 
             size_t size() const;
+            bool empty() const;
+
+            std::vector<Member>::const_iterator begin() const;
+            std::vector<Member>::const_iterator end() const;
+
+            /**
+             * @brief Serializes the object with JsonSerializer.
+             * @param prettyPrint If true, writes one member per line, indented with tabs.
+             * @param indentLevel Indentation level of the object itself.
+             * @return The JSON text.
+             */
             std::string toString(bool prettyPrint = false, int indentLevel = 0) const;
 
             /**
@@ -76,15 +127,22 @@ namespace r_utils {
              */
             r_utils::json::Json toJson() const;
 
-        private:
-            std::unordered_map<std::string, r_utils::json::JsonElement> values;
+            /** @brief Number of members up to which lookups are linear scans without an index. */
+            static constexpr size_t INDEX_THRESHOLD = 16;
 
-            /**
-             * @brief Returns indentation spaces for pretty-printing.
-             * @param level Indentation level.
-             * @return String of spaces corresponding to the level.
-             */
-            static std::string indent(int level);
+        private:
+            /** @brief Returns the position of the key, or size() if it does not exist. */
+            size_t find(std::string_view key) const;
+            /** @brief Like find(std::string_view), but short-circuits on keys that share their string. */
+            size_t findKey(const r_utils::json::JsonKey& key) const;
+            /** @brief Rebuilds the hash index, or drops it if the object is small enough. */
+            void rebuildIndex();
+            /** @brief Adds the member at the given position to the hash index. */
+            void indexMember(size_t position);
+
+            std::vector<Member> values;
+            /** Open-addressing table of member positions plus one; 0 marks an empty slot. */
+            std::vector<uint32_t> index;
         };
 
         std::ostream& operator<<(std::ostream& os, const r_utils::json::JsonObject& obj);
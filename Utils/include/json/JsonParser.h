@@ -1,10 +1,16 @@
 #pragma once
 
 #include <iostream>
+#include <string_view>
+#include <vector>
 
 #include "json/JsonObject.h"
 #include "json/JsonElement.h"
 #include "json/JsonArray.h"
+#include "json/JsonStructuralIndex.h"
+#include "json/IJsonHandler.h"
+#include "json/JsonKeyPool.h"
+#include "json/JsonProjection.h"
 #include "file/File.h"
 
 namespace r_utils
@@ -19,6 +25,16 @@ namespace r_utils
 		 * and returns the result as a JsonElement. It also contains internal methods
 		 * for parsing specific JSON types, including objects, arrays, strings, numbers,
 		 * booleans, and null values.
+		 *
+		 * Parsing runs in two stages: a JsonStructuralIndex locates the tokens of the
+		 * input one window at a time, then the recursive descent below jumps from token
+		 * to token instead of walking the input byte by byte.
+		 *
+		 * Instead of building a JsonElement tree, the parser can also report the document
+		 * as a stream of events to an IJsonHandler.
+		 *
+		 * Every entry point expects exactly one value: anything but whitespace after it
+		 * is reported as an error.
 		 */
 		class JsonParser
 		{
@@ -28,35 +44,187 @@ namespace r_utils
 
 			/**
 			 * @brief Parses a JSON string into a JsonElement.
-			 * @param input JSON string to parse.
+			 *
+			 * The input is parsed in place; it is not copied and only has to stay
+			 * alive for the duration of the call.
+			 *
+			 * @param input JSON text to parse.
 			 * @return JsonElement representing the parsed JSON data.
 			 * @throws JsonParserException if parsing fails.
 			 */
-			static JsonElement parse(const std::string& input);
+			static JsonElement parse(std::string_view input);
 
 			/**
 			 * @brief Parses a JSON file into a JsonElement.
+			 *
+			 * The file is read once into a single buffer which is parsed in place.
+			 *
 			 * @param file File object containing JSON data.
 			 * @return JsonElement representing the parsed JSON data.
 			 * @throws JsonParserException if parsing fails.
 			 */
 			static JsonElement parse(const r_utils::io::File& file);
 
+			/**
+			 * @brief Parses a JSON string and reports it as events without building a tree.
+			 * @param input JSON text to parse.
+			 * @param handler Handler receiving the parse events.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static void parse(std::string_view input, IJsonHandler& handler);
+
+			/**
+			 * @brief Parses a JSON file and reports it as events without building a tree.
+			 *
+			 * The file is parsed straight from a read-only memory mapping with a sequential
+			 * access hint, so the OS pages it in and out as needed instead of the whole file
+			 * being held in a buffer. Only the structural index window and the container
+			 * nesting take memory of their own.
+			 *
+			 * @param file File object containing JSON data.
+			 * @param handler Handler receiving the parse events.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static void parse(const r_utils::io::File& file, IJsonHandler& handler);
+
+			/**
+			 * @brief Parses a JSON string, taking all object keys from a shared pool.
+			 * @param input JSON text to parse.
+			 * @param keyPool Pool that interns the keys; objects share one string per distinct key.
+			 * @return The parsed JsonElement.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonElement parse(std::string_view input, JsonKeyPool& keyPool);
+
+			/**
+			 * @brief Parses a JSON file, taking all object keys from a shared pool.
+			 * @param file File object containing JSON data.
+			 * @param keyPool Pool that interns the keys.
+			 * @return The parsed JsonElement.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonElement parse(const r_utils::io::File& file, JsonKeyPool& keyPool);
+
+			/**
+			 * @brief Parses only the selected values of a JSON string.
+			 *
+			 * The result keeps the shape of the document but contains only the values
+			 * selected by the projection, plus the objects and arrays on the way to them.
+			 * Objects and arrays that contain none of the paths are left out, except the
+			 * root and the elements of arrays selected with "*", which keep their
+			 * positions. All other values are skipped without being decoded: their brackets
+			 * must match, but malformed scalars or separators inside them are not reported.
+			 *
+			 * @param input JSON text to parse.
+			 * @param projection The paths to extract.
+			 * @return The projected JsonElement.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonElement parse(std::string_view input, const JsonProjection& projection);
+
+			/**
+			 * @brief Parses only the selected values of a JSON file.
+			 * @param file File object containing JSON data.
+			 * @param projection The paths to extract.
+			 * @return The projected JsonElement.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonElement parse(const r_utils::io::File& file, const JsonProjection& projection);
+
+			/**
+			 * @brief Parses a large top-level array on several threads.
+			 *
+			 * A single pass over the structural index finds the commas between the top-level
+			 * elements and cuts the array into element-aligned ranges of similar size. Worker
+			 * threads parse the ranges independently and the elements are joined into one
+			 * JsonArray in input order. Inputs that are small or not an array are parsed
+			 * on the calling thread.
+			 *
+			 * @param input JSON text to parse.
+			 * @param threadCount Number of worker threads, or 0 to use one per hardware thread.
+			 * @return The parsed JsonElement.
+			 * @throws JsonParserException if parsing fails; the error of the earliest failing range is reported.
+			 */
+			static JsonElement parseParallel(std::string_view input, unsigned int threadCount = 0);
+
+			/**
+			 * @brief Parses a JSON file whose root is a large array on several threads.
+			 * @param file File object containing JSON data.
+			 * @param threadCount Number of worker threads, or 0 to use one per hardware thread.
+			 * @return The parsed JsonElement.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonElement parseParallel(const r_utils::io::File& file, unsigned int threadCount = 0);
+
+			/**
+			 * @brief Converts a number literal into a JsonElement without allocating.
+			 *
+			 * Literals without a fraction or exponent that fit into an int become Int,
+			 * everything else becomes Double. Values too small for a double underflow to
+			 * a denormal or a signed zero, e.g. "1e-400" becomes 0.0.
+			 *
+			 * @param literal The complete literal, e.g. "-12", "3.5" or "1e9".
+			 * @return An element of type Int or Double.
+			 * @throws JsonParserException if the literal is not a valid number, or if its
+			 * magnitude is too large for a double, e.g. "1e400".
+			 */
+			static JsonElement toNumber(std::string_view literal);
+
+			/**
+			 * @brief Reports a number literal to a handler without losing integer precision.
+			 *
+			 * Integral literals go to onInt, onInt64 or onUint64, the first whose type holds
+			 * them; all others go to onNumber.
+			 *
+			 * @throws JsonParserException if the literal is not a valid number.
+			 */
+			static void emitNumber(std::string_view literal, IJsonHandler& handler);
+
+			/**
+			 * @brief Decodes the escape sequence that follows a backslash.
+			 *
+			 * \uXXXX escapes are UTF-16 code units and are appended as UTF-8; a high
+			 * surrogate must be followed by an escaped low surrogate, and the pair becomes
+			 * one four-byte character. Other escaped characters stand for themselves.
+			 *
+			 * @param escape The text after the backslash. It may end before the sequence does.
+			 * @param out Receives the decoded character.
+			 * @return The number of characters consumed, or 0 if escape ends too early.
+			 * @throws JsonParserException on invalid hex digits or an unpaired surrogate.
+			 */
+			static size_t unescape(std::string_view escape, std::string& out);
+
 		private:
 			/**
-			 * @brief Private constructor for internal parsing from a string.
-			 * @param input JSON string to parse.
+			 * @brief Private constructor for internal parsing over a borrowed buffer.
+			 * @param input JSON text to parse. Must outlive the parser.
 			 */
-			explicit JsonParser(std::string input);
+			explicit JsonParser(std::string_view input);
 
-			/** @brief Returns the next character without advancing the position. */
-			char peek() const;
-			/** @brief Returns the next character and advances the position. */
-			char next();
-			/** @brief Checks if the end of input has been reached. */
-			bool eof() const;
-			/** @brief Skips whitespace characters in the input. */
-			void skipWhitespace();
+			/** @brief Returns the character at the current structural position without advancing. */
+			char peek();
+			/** @brief Returns the input offset of the current structural position and advances. */
+			size_t next();
+			/** @brief Checks if all structural positions have been consumed, indexing the next window if needed. */
+			bool eof();
+			/** @brief Checks that a scalar ending at the given offset is followed by a delimiter. */
+			void expectDelimiter(size_t end) const;
+			/** @brief Checks that nothing but whitespace follows the root value. */
+			void expectEnd();
+
+			/** @brief Reads the null literal at the next structural position. */
+			void readNull();
+			/** @brief Reads the boolean literal at the next structural position. */
+			bool readBool();
+			/** @brief Reads the literal of the number at the next structural position. */
+			std::string_view readNumberLiteral();
+			/** @brief Reads the number at the next structural position as an Int or Double element. */
+			JsonElement readNumber();
+			/**
+			 * @brief Reads the string at the next structural position.
+			 * @return A view into the input, or into an internal buffer if the string had to be unescaped.
+			 */
+			std::string_view readString();
 
 			/** @brief Parses a generic JSON value (object, array, string, number, bool, or null). */
 			JsonElement parseValue();
@@ -72,9 +240,47 @@ namespace r_utils
 			JsonArray parseArray();
 			/** @brief Parses a JSON object. */
 			JsonObject parseObject();
+			/** @brief Parses comma-separated values up to the end of the input, as found between array brackets. */
+			void parseElements(std::vector<JsonElement>& elements);
+
+			/**
+			 * @brief Moves past the next value, jumping over nested containers on the structural index.
+			 *
+			 * Only the brackets are checked: each closer must match its opening bracket. Scalars,
+			 * strings, commas and colons inside the skipped value are not validated.
+			 */
+			void skipValue();
+			/**
+			 * @brief Parses the parts of the next value selected by the given projection node.
+			 * @param node Projection trie node the value corresponds to.
+			 * @param keepEmpty If true, a value without any selected parts still yields an empty container or null.
+			 * @param out Receives the projected value.
+			 * @return True if out was set, false if the value was skipped.
+			 */
+			bool parseProjected(uint32_t node, bool keepEmpty, JsonElement& out);
+
+			/** @brief Reports a generic JSON value to the handler. */
+			void emitValue(IJsonHandler& handler);
+			/** @brief Reports a JSON array to the handler. */
+			void emitArray(IJsonHandler& handler);
+			/** @brief Reports a JSON object to the handler. */
+			void emitObject(IJsonHandler& handler);
+
+			/** @brief Number of input bytes indexed at a time. */
+			static constexpr size_t INDEX_WINDOW_SIZE = 64 * 1024;
+			/** @brief Inputs smaller than this are never split across threads. */
+			static constexpr size_t PARALLEL_MIN_SIZE = 1024 * 1024;
+			/** @brief Number of ranges per worker thread, so that uneven ranges still balance out. */
+			static constexpr size_t PARALLEL_RANGES_PER_THREAD = 4;
 
-			std::string input;
-			size_t pos;
+			std::string_view input;
+			JsonStructuralIndex index;
+			size_t cursor;
+			std::string unescaped;
+			/** Closers that skipValue() expects for the brackets it has opened. */
+			std::vector<char> closers;
+			JsonKeyPool* keyPool = nullptr;
+			const JsonProjection* projection = nullptr;
 		};
 	} // json
 } // r_utils
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "json/JsonElement.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonPatch
+		 * @brief JSON Patch (RFC 6902) and JSON Merge Patch (RFC 7386) for JsonElement trees.
+		 *
+		 * A JSON Patch is an array of operations such as
+		 * `{"op": "replace", "path": "/user/name", "value": "Bro"}`; the operations are
+		 * add, remove, replace, move, copy and test. A merge patch is a partial document
+		 * whose members overwrite the target and whose nulls delete members.
+		 *
+		 * diff() and mergeDiff() produce patches that turn one document into another.
+		 * Subtrees that both documents share (see JsonElement::sharesWith) are skipped
+		 * without being visited, so diffing two versions of a large document costs about
+		 * as much as walking the parts that changed. Array elements are paired up by their
+		 * cached structural hash (JsonElement::hash).
+		 *
+		 * @code
+		 * JsonArray patch = JsonPatch::diff(previous, current);
+		 * send(JsonSerializer::serialize(patch));
+		 * // on the other side
+		 * JsonPatch::apply(replica, JsonParser::parse(received).asArray());
+		 * @endcode
+		 */
+		class JsonPatch
+		{
+		public:
+			/**
+			 * @brief Applies a JSON Patch.
+			 *
+			 * Either all operations are applied or, if one fails, the document is left
+			 * unchanged. Thanks to copy-on-write this costs no copy of the document.
+			 *
+			 * @param document The document to modify.
+			 * @param patch Array of operation objects.
+			 * @throws r_utils::exception::JsonPatchException if an operation is malformed, a path
+			 * does not exist or a test fails.
+			 */
+			static void apply(JsonElement& document, const JsonArray& patch);
+
+			/**
+			 * @brief Computes a JSON Patch that turns source into target.
+			 *
+			 * Object members are added, removed or patched recursively. Arrays are matched
+			 * by their longest common subsequence of elements, so an insertion in the middle
+			 * produces one add instead of a replace for every following element.
+			 *
+			 * @return The operations; empty if the documents are equal.
+			 */
+			static JsonArray diff(const JsonElement& source, const JsonElement& target);
+
+			/**
+			 * @brief Applies a JSON Merge Patch.
+			 *
+			 * Members of an object patch are merged recursively into the document, members
+			 * whose value is null are removed, and any other patch value replaces the document.
+			 */
+			static void merge(JsonElement& document, const JsonElement& patch);
+
+			/**
+			 * @brief Computes a JSON Merge Patch that turns source into target.
+			 *
+			 * Merge patches cannot set a member to null, because null means removal; such
+			 * members are removed instead.
+			 */
+			static JsonElement mergeDiff(const JsonElement& source, const JsonElement& target);
+		};
+	} // json
+} // r_utils
\ No newline at end of file
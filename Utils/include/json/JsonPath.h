@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonElement.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonPath
+		 * @brief A compiled JSONPath query that selects elements from a document.
+		 *
+		 * The expression is parsed once into a list of steps; evaluating it only walks the
+		 * tree and collects pointers to the matching elements, so one query can be applied
+		 * to many documents cheaply. Supported syntax:
+		 *
+		 * | Syntax | Selects |
+		 * |--------|---------|
+		 * | `$` | The root (every path starts with it) |
+		 * | `.name`, `['name']` | The member with that key |
+		 * | `[n]` | The n-th array element; negative indices count from the end |
+		 * | `.*`, `[*]` | All elements of an array or all member values of an object |
+		 * | `..name`, `..*` | The named member, or all children, at any depth |
+		 * | `[?(@.a.b)]` | Children that have the relative path `a.b` |
+		 * | `[?(@.a op literal)]` | Children whose value compares to a literal; op is one of `== != < <= > >=` |
+		 *
+		 * Literals are numbers, 'single' or "double" quoted strings, true, false and null.
+		 *
+		 * @code
+		 * const JsonPath prices("$.store.book[?(@.price < 10)].title");
+		 * for (const JsonElement* title : prices.evaluate(root))
+		 *     std::cout << title->asString() << '\n';
+		 * @endcode
+		 */
+		class JsonPath
+		{
+		public:
+			/**
+			 * @brief Compiles a JSONPath expression.
+			 * @param path The expression, starting with '$'.
+			 * @throws r_utils::exception::JsonPathException if the expression is malformed or unsupported.
+			 */
+			explicit JsonPath(std::string_view path);
+
+			/**
+			 * @brief Selects all matching elements in document order.
+			 * @param root Document to search.
+			 * @return Pointers into root; valid as long as root is not modified.
+			 */
+			std::vector<const JsonElement*> evaluate(const JsonElement& root) const;
+
+			/**
+			 * @brief Appends all matching elements to an existing vector.
+			 *
+			 * Reusing one vector across documents avoids an allocation per evaluation.
+			 */
+			void evaluate(const JsonElement& root, std::vector<const JsonElement*>& results) const;
+
+			/**
+			 * @brief Returns the first matching element, stopping the search there.
+			 * @return The element, or nullptr if nothing matches.
+			 */
+			const JsonElement* first(const JsonElement& root) const;
+
+			/** @brief Returns the expression the path was compiled from. */
+			[[nodiscard]] const std::string& toString() const;
+
+		private:
+			enum class StepType { Key, Index, Wildcard, DescendantKey, DescendantWildcard, Filter };
+			enum class Operator { Exists, Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
+
+			struct Step
+			{
+				StepType type;
+				std::string key{};
+				int index = 0;
+				/** Relative path of a filter; only Key and Index steps. */
+				std::vector<Step> filterPath{};
+				Operator filterOperator = Operator::Exists;
+				JsonElement filterValue{};
+			};
+
+			class Compiler;
+
+			/** @brief Applies steps[step..] to the node. Returns true once results holds limit elements. */
+			bool walk(const JsonElement& node, size_t step, std::vector<const JsonElement*>& results, size_t limit) const;
+			/** @brief Visits the node and all its descendants for a descendant step. */
+			bool descend(const JsonElement& node, size_t step, std::vector<const JsonElement*>& results, size_t limit) const;
+			/** @brief Returns true if the element passes the filter of the given step. */
+			static bool matches(const Step& filter, const JsonElement& element);
+
+			std::string expression;
+			std::vector<Step> steps;
+		};
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonElement.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonPointer
+		 * @brief A compiled RFC 6901 JSON Pointer such as "/users/0/name".
+		 *
+		 * The pointer is split and unescaped once, when it is constructed, and array
+		 * indices are converted to integers up front. evaluate() then walks the tree
+		 * and returns a pointer to the element it finds, without copying anything.
+		 *
+		 * @code
+		 * const JsonPointer name("/users/0/name");
+		 * if (const JsonElement* value = name.evaluate(root))
+		 *     std::cout << value->asString();
+		 * @endcode
+		 */
+		class JsonPointer
+		{
+		public:
+			/** One reference token of the pointer. */
+			struct Token
+			{
+				/** The unescaped token, used as an object key. */
+				std::string name;
+				/** The token as an array index, or -1 if it is not one ("-" is also -1). */
+				int index;
+			};
+
+			/** Default constructor. Creates the pointer "" to the whole document. */
+			JsonPointer() = default;
+
+			/**
+			 * @brief Compiles a JSON Pointer.
+			 * @param pointer "" or a sequence of "/token" parts, with "~1" for '/' and "~0" for '~'.
+			 * @throws r_utils::exception::JsonPathException if the pointer is malformed.
+			 */
+			explicit JsonPointer(std::string_view pointer);
+
+			/**
+			 * @brief Looks up the element the pointer refers to.
+			 * @param root Document to search.
+			 * @return The element, or nullptr if any step does not exist.
+			 */
+			const JsonElement* evaluate(const JsonElement& root) const;
+			/** @copydoc evaluate(const JsonElement&) const */
+			JsonElement* evaluate(JsonElement& root) const;
+
+			/** @brief Returns true if the pointer refers to the whole document. */
+			[[nodiscard]] bool isRoot() const;
+
+			/** @brief Returns the pointer to the parent of the referenced element. The root is its own parent. */
+			[[nodiscard]] JsonPointer parent() const;
+
+			/** @brief Returns the pointer extended by one token. */
+			[[nodiscard]] JsonPointer append(std::string_view token) const;
+
+			/** @brief Returns the compiled tokens. */
+			[[nodiscard]] const std::vector<Token>& getTokens() const;
+
+			/** @brief Returns the pointer in its escaped text form. */
+			[[nodiscard]] std::string toString() const;
+
+			/** @brief Escapes '~' and '/' in a single token. */
+			static std::string escape(std::string_view token);
+
+		private:
+			std::vector<Token> tokens;
+		};
+
+		bool operator==(const r_utils::json::JsonPointer& x, const r_utils::json::JsonPointer& y);
+	} // json
+} // r_utils
\ No newline at end of file
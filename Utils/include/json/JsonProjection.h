@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace r_utils
+{
+	namespace json
+	{
+		class JsonPointer;
+
+		/**
+		 * @class JsonProjection
+		 * @brief A set of paths to extract when parsing, compiled into a trie.
+		 *
+		 * Passing a projection to JsonParser::parse() builds only the selected values and
+		 * the objects and arrays leading to them. Everything else is skipped on the
+		 * structural index without being decoded or allocated.
+		 *
+		 * Paths are JSON Pointers (RFC 6901). A token matches an object key, or an array
+		 * index if it is a number; the token "*" matches every element of an array. An
+		 * element that is also named by number gets the union of both sets of paths.
+		 *
+		 * @code
+		 * const JsonProjection fields{ "/timestamp", "/level", "/request/path" };
+		 * JsonElement record = JsonParser::parse(line, fields);
+		 * @endcode
+		 */
+		class JsonProjection
+		{
+		public:
+			/** Default constructor. Creates a projection that selects nothing. */
+			JsonProjection();
+
+			/**
+			 * @brief Creates a projection from a list of paths.
+			 * @throws r_utils::exception::JsonPathException if a path is not a valid JSON Pointer.
+			 */
+			JsonProjection(std::initializer_list<std::string_view> paths);
+
+			/**
+			 * @brief Adds a path to the projection.
+			 * @param path JSON Pointer to the value to extract. "" selects the whole document.
+			 * @return Reference to this projection for chaining.
+			 * @throws r_utils::exception::JsonPathException if the path is not a valid JSON Pointer.
+			 */
+			JsonProjection& add(std::string_view path);
+
+			/** @brief Returns true if no path has been added. */
+			[[nodiscard]] bool empty() const;
+
+			/** @brief Id of the trie node for the document root. */
+			static constexpr uint32_t ROOT = 0;
+			/** @brief Returned by child() if a key is not part of any path. */
+			static constexpr uint32_t NONE = UINT32_MAX;
+
+			/** @brief Returns the node reached from node by key, or NONE. */
+			[[nodiscard]] uint32_t child(uint32_t node, std::string_view key) const;
+			/** @brief Returns the node reached from node by an array index, or NONE. Falls back to the "*" node for unnamed indices. */
+			[[nodiscard]] uint32_t child(uint32_t node, size_t index) const;
+			/** @brief Returns true if a "*" path continues from node. */
+			[[nodiscard]] bool hasWildcard(uint32_t node) const;
+			/** @brief Returns true if the whole value at node is selected. */
+			[[nodiscard]] bool isSelected(uint32_t node) const;
+
+		private:
+			struct Node
+			{
+				/** Children by object key, numeric tokens included. */
+				std::vector<std::pair<std::string, uint32_t>> children;
+				/** Children by array index; each also holds the paths of the "*" child. */
+				std::vector<std::pair<size_t, uint32_t>> elements;
+				uint32_t wildcard = NONE;
+				bool selected = false;
+			};
+
+			/** @brief Adds the tokens of pointer from position on below node. */
+			void insert(uint32_t node, const JsonPointer& pointer, size_t position);
+			/** @brief Deep-copies the subtrie at node and returns the id of the copy. */
+			uint32_t copy(uint32_t node);
+
+			std::vector<Node> nodes;
+		};
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/IJsonHandler.h"
+#include "json/JsonElement.h"
+#include "json/JsonElementBuilder.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonPushParser
+		 * @brief Resumable parser for JSON that arrives in arbitrary chunks.
+		 *
+		 * Input is pushed with feed() as it becomes available, e.g. straight from a pipe or
+		 * socket read. The parser keeps its state between calls, so chunks may end anywhere,
+		 * including in the middle of a string, an escape sequence, a number or a literal.
+		 * The stream may contain any number of whitespace-separated top-level values.
+		 *
+		 * Results are delivered either as events to an IJsonHandler or, one completed
+		 * top-level value at a time, as JsonElements to a callback.
+		 */
+		class JsonPushParser
+		{
+		public:
+			/**
+			 * @brief Creates a parser that reports all values as events.
+			 * @param handler Handler receiving the parse events. Must outlive the parser.
+			 */
+			explicit JsonPushParser(IJsonHandler& handler);
+
+			/**
+			 * @brief Creates a parser that builds every top-level value into a JsonElement.
+			 * @param onElement Callback invoked with each completed top-level value.
+			 */
+			explicit JsonPushParser(std::function<void(JsonElement)> onElement);
+
+			/**
+			 * @brief Parses the next chunk of input.
+			 * @param data Pointer to the chunk. Does not have to outlive the call.
+			 * @param size Number of bytes in the chunk.
+			 * @throws JsonParserException on malformed input.
+			 */
+			void feed(const char* data, size_t size);
+
+			/**
+			 * @brief Parses the next chunk of input.
+			 * @param data The chunk. Does not have to outlive the call.
+			 * @throws JsonParserException on malformed input.
+			 */
+			void feed(std::string_view data);
+
+			/**
+			 * @brief Signals the end of input and completes a trailing number or literal.
+			 * @throws JsonParserException if the input ended inside a value.
+			 */
+			void finish();
+
+		private:
+			/**
+			 * @brief What the parser expects next.
+			 */
+			enum class State {
+				Value,      /**< Any value */
+				FirstValue, /**< A value or ']' right after '[' */
+				FirstKey,   /**< A key or '}' right after '{' */
+				Key,        /**< A key after ',' */
+				Colon,      /**< ':' after a key */
+				AfterValue, /**< ',' or the closing bracket of the current container */
+				String,     /**< Inside a string or key */
+				Number,     /**< Inside a number */
+				Literal     /**< Inside true, false or null */
+			};
+
+			/** @brief Handles one character outside of strings, numbers and literals. */
+			void structural(char c);
+			/** @brief Consumes string content starting at data[i] and returns the index after it. */
+			size_t string(const char* data, size_t i, size_t size);
+			/** @brief Emits the completed number or literal in the token buffer. */
+			void finishToken();
+			/** @brief Advances the state after a complete value. */
+			void endValue();
+
+			IJsonHandler* handler;
+			std::unique_ptr<JsonElementBuilder> builder;
+			std::function<void(JsonElement)> onElement;
+
+			State state = State::Value;
+			std::vector<char> stack;
+			std::string token;
+			char quote = '"';
+			bool isKey = false;
+			bool escape = false;
+			/** Characters of an unfinished escape sequence after the backslash. */
+			std::string escapeSequence;
+		};
+	} // json
+} // r_utils
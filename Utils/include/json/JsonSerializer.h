@@ -0,0 +1,96 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "json/JsonElement.h"
+#include "json/JsonObject.h"
+#include "json/JsonArray.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonSerializer
+		 * @brief Writes JSON values into a single growable buffer.
+		 *
+		 * The serializer walks a value once and appends directly to its buffer; children
+		 * are visited in place and never copied. Numbers are formatted with std::to_chars
+		 * (shortest round-trip representation for doubles) and strings are escaped
+		 * according to RFC 8259.
+		 *
+		 * The buffer keeps its capacity across clear(), so one serializer can be reused
+		 * for many values without reallocating.
+		 */
+		class JsonSerializer
+		{
+		public:
+			/**
+			 * @brief Creates a serializer.
+			 * @param prettyPrint If true, objects and nested arrays are written one member per line, indented with tabs.
+			 */
+			explicit JsonSerializer(bool prettyPrint = false);
+
+			/**
+			 * @brief Appends a value to the buffer.
+			 * @param element Value to serialize.
+			 * @param indentLevel Indentation level of the value when pretty-printing.
+			 * @return Reference to this serializer for chaining.
+			 */
+			JsonSerializer& write(const JsonElement& element, int indentLevel = 0);
+			/** @copydoc write(const JsonElement&, int) */
+			JsonSerializer& write(const JsonObject& object, int indentLevel = 0);
+			/** @copydoc write(const JsonElement&, int) */
+			JsonSerializer& write(const JsonArray& array, int indentLevel = 0);
+
+			/** @brief Returns the serialized output. */
+			[[nodiscard]] const std::string& getBuffer() const;
+			/** @brief Moves the serialized output out of the serializer. */
+			std::string take();
+			/** @brief Empties the buffer but keeps its capacity. */
+			void clear();
+
+			/**
+			 * @brief Serializes a value into a new string.
+			 * @param element Value to serialize.
+			 * @param prettyPrint Whether to pretty-print.
+			 * @return The JSON text.
+			 */
+			static std::string serialize(const JsonElement& element, bool prettyPrint = false);
+
+			/**
+			 * @brief Appends a quoted and escaped JSON string.
+			 *
+			 * Runs of characters that need no escaping are found 16 bytes at a time with
+			 * SSE2 where available and copied in one go.
+			 *
+			 * @param out Buffer to append to.
+			 * @param value Raw string value.
+			 */
+			static void appendString(std::string& out, std::string_view value);
+			/** @brief Appends an integer. */
+			static void appendNumber(std::string& out, int value);
+			/** @brief Appends a 64-bit integer. */
+			static void appendNumber(std::string& out, long long value);
+			/** @brief Appends an unsigned 64-bit integer. */
+			static void appendNumber(std::string& out, unsigned long long value);
+			/**
+			 * @brief Appends a double in its shortest round-trip form.
+			 *
+			 * Integral values keep a ".0" suffix so they are read back as Double. NaN and
+			 * infinity have no JSON representation and are written as null.
+			 */
+			static void appendNumber(std::string& out, double value);
+
+		private:
+			void writeValue(const JsonElement& element, int level);
+			void writeObject(const JsonObject& object, int level);
+			void writeArray(const JsonArray& array, int level);
+			void newline(int level);
+
+			std::string buffer;
+			bool prettyPrint;
+		};
+	} // json
+} // r_utils
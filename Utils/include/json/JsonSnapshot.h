@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+
+#include "json/JsonTape.h"
+#include "json/JsonView.h"
+#include "file/File.h"
+#include "file/MappedFile.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonSnapshot
+		 * @brief A JSON document saved in a binary file that is used straight from a memory mapping.
+		 *
+		 * A snapshot file is a fixed header followed by the words and the string buffer of a
+		 * JsonTape. Since the tape only holds relative offsets, opening a snapshot maps the
+		 * file and checks the header; nothing is parsed or copied, so opening costs the same
+		 * for any document size and pages are only read from disk when they are visited.
+		 * The document is read through JsonValueView, which mirrors the isX()/asX() API of
+		 * JsonElement.
+		 *
+		 * Layout (all integers in native byte order; the header records it):
+		 *
+		 * | Offset | Size | Field |
+		 * |--------|------|-------|
+		 * | 0 | 8 | Magic "RUJSNAP\0" |
+		 * | 8 | 4 | Format version, currently 1 |
+		 * | 12 | 4 | Byte order mark 0x01020304 |
+		 * | 16 | 8 | Number of tape words |
+		 * | 24 | 8 | Size of the string buffer in bytes |
+		 * | 32 | 8 | File offset of the tape words |
+		 * | 40 | 8 | File offset of the string buffer |
+		 *
+		 * Opening checks the header, the bounds of both sections and the root value, but
+		 * trusts the tape contents. Call validate() before reading a file that may be
+		 * corrupted or comes from an untrusted source.
+		 *
+		 * @code
+		 * JsonSnapshot::write(JsonTape::parse(File("catalog.json")), File("catalog.snap"));
+		 * const JsonSnapshot snapshot = JsonSnapshot::open(File("catalog.snap"));
+		 * const int count = snapshot.getRoot().asObject().get("count").asInt();
+		 * @endcode
+		 */
+		class JsonSnapshot
+		{
+		public:
+			/** @brief Current version of the file format. */
+			static constexpr uint32_t VERSION = 1;
+
+			/**
+			 * @brief Writes a tape into a snapshot file, replacing its contents.
+			 * @throws r_utils::exception::FileException if the file cannot be written.
+			 */
+			static void write(const JsonTape& tape, const r_utils::io::File& file);
+
+			/**
+			 * @brief Writes a JsonElement tree into a snapshot file, replacing its contents.
+			 * @throws r_utils::exception::FileException if the file cannot be written.
+			 */
+			static void write(const JsonElement& element, const r_utils::io::File& file);
+
+			/**
+			 * @brief Maps a snapshot file.
+			 * @param file The snapshot to open.
+			 * @return The snapshot; views into it stay valid as long as it exists.
+			 * @throws r_utils::exception::FileException if the file cannot be mapped.
+			 * @throws JsonParserException if the file is not a valid snapshot of this version
+			 * and byte order.
+			 */
+			static JsonSnapshot open(const r_utils::io::File& file);
+
+			/**
+			 * @brief Checks every tape word, so that views never read outside the mapping.
+			 *
+			 * Verifies tags, string offsets and lengths, container distances, element counts
+			 * and nesting. This touches every word once and is linear in the size of the tape.
+			 *
+			 * @throws JsonParserException if the tape is corrupted.
+			 */
+			void validate() const;
+
+			/** @brief Returns a view of the root value. */
+			[[nodiscard]] JsonValueView getRoot() const;
+
+			/** @brief Returns the number of tape words. */
+			[[nodiscard]] size_t getWordCount() const;
+			/** @brief Returns the size of the string buffer in bytes. */
+			[[nodiscard]] size_t getStringsSize() const;
+
+		private:
+			explicit JsonSnapshot(r_utils::io::MappedFile mapping);
+
+			r_utils::io::MappedFile mapping;
+			const uint64_t* words = nullptr;
+			size_t wordCount = 0;
+			const char* strings = nullptr;
+			size_t stringsSize = 0;
+		};
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonStructuralIndex
+		 * @brief First parsing stage: the positions of all structural characters in a JSON text.
+		 *
+		 * The index records, in input order, the offset of every structural character
+		 * (`{`, `}`, `[`, `]`, `:`, `,`) outside of strings, every opening quote and the
+		 * first character of every other scalar (numbers, `true`, `false`, `null`).
+		 * Closing quotes and whitespace are never part of the index, so a parser can
+		 * jump from token to token without looking at the bytes in between.
+		 *
+		 * The index is built with SIMD kernels (AVX2 or SSE4.2, selected once at runtime)
+		 * that classify 64 bytes at a time into bitmaps, either for the whole input or
+		 * window by window. Inputs containing single-quoted
+		 * strings, and CPUs without the required instruction sets, use a scalar
+		 * byte-wise builder that produces the same positions.
+		 */
+		class JsonStructuralIndex
+		{
+		public:
+			/**
+			 * @enum Implementation
+			 * @brief The stage-one kernel used on the current CPU.
+			 */
+			enum class Implementation {
+				Scalar, /**< Byte-wise fallback */
+				SSE42,  /**< 16-byte SSE4.2 kernel */
+				AVX2    /**< 32-byte AVX2 kernel */
+			};
+
+			/** Default constructor. Creates an empty index. */
+			JsonStructuralIndex() = default;
+
+			/**
+			 * @brief Builds the index for the whole input.
+			 * @param input JSON text to index. Must outlive the index.
+			 * @throws JsonParserException if the input is larger than 4 GiB.
+			 */
+			explicit JsonStructuralIndex(std::string_view input);
+
+			/**
+			 * @brief Indexes the input one window at a time.
+			 *
+			 * Only the first window is indexed on construction; advance() replaces the
+			 * positions with those of the next window. This keeps the index small and
+			 * cache resident regardless of the input size.
+			 *
+			 * @param input JSON text to index. Must outlive the index.
+			 * @param windowSize Number of input bytes per window (rounded up to 64), or 0 for the whole input.
+			 * @throws JsonParserException if the input is larger than 4 GiB.
+			 */
+			JsonStructuralIndex(std::string_view input, size_t windowSize);
+
+			/**
+			 * @brief Indexes the input one window at a time with a specific kernel.
+			 *
+			 * Every kernel produces the same positions; this constructor exists to compare
+			 * them. A kernel the CPU does not support is replaced by the scalar builder.
+			 *
+			 * @param input JSON text to index. Must outlive the index.
+			 * @param windowSize Number of input bytes per window (rounded up to 64), or 0 for the whole input.
+			 * @param implementation Kernel to use.
+			 * @throws JsonParserException if the input is larger than 4 GiB.
+			 */
+			JsonStructuralIndex(std::string_view input, size_t windowSize, Implementation implementation);
+
+			/**
+			 * @brief Replaces the positions with those of the next window.
+			 * @return False if the whole input has already been indexed.
+			 */
+			bool advance();
+
+			/** @brief Checks whether the whole input has been indexed. */
+			[[nodiscard]] bool complete() const;
+
+			/** @brief Returns the number of structural positions in the current window. */
+			[[nodiscard]] size_t size() const;
+			/** @brief Checks whether the input contained no tokens at all. */
+			[[nodiscard]] bool empty() const;
+			/** @brief Returns the input offset of the structural at the given index. */
+			[[nodiscard]] uint32_t operator[](size_t index) const;
+
+			/**
+			 * @brief Returns the structural positions of the current window in input order.
+			 * @return Constant reference to the internal position vector.
+			 */
+			[[nodiscard]] const std::vector<uint32_t>& getPositions() const;
+
+			/**
+			 * @brief Returns the kernel selected for this CPU.
+			 * @return The implementation used by all indexes built in this process.
+			 */
+			static Implementation getImplementation();
+
+			/**
+			 * @brief Checks whether a kernel can run on this CPU.
+			 * @param implementation Kernel to check.
+			 * @return True for the scalar builder and every kernel up to getImplementation().
+			 */
+			static bool isSupported(Implementation implementation);
+
+			/**
+			 * @brief Scanner state carried from one block and window into the next.
+			 */
+			struct ScanState
+			{
+				uint64_t prevEscaped = 0;  /**< Lowest bit set if the next byte is escaped */
+				uint64_t prevInString = 0; /**< All bits set if the next byte is inside a string */
+				uint64_t prevScalar = 0;   /**< Lowest bit set if the previous byte belongs to a scalar */
+				char quote = '"';          /**< Quote character of the open string (scalar builder only) */
+				bool scalar = false;       /**< True once the scalar builder has taken over */
+			};
+
+		private:
+			void indexWindow();
+
+			std::string_view input;
+			size_t windowSize = 0;
+			Implementation implementation = Implementation::Scalar;
+			size_t indexed = 0;
+			ScanState state;
+			std::vector<uint32_t> positions;
+		};
+
+		std::ostream& operator<<(std::ostream& os, const JsonStructuralIndex::Implementation& implementation);
+	} // json
+} // r_utils
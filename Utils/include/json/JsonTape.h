@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonView.h"
+#include "file/File.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonTape
+		 * @brief A parsed JSON document stored as a flat tape of 64-bit words.
+		 *
+		 * Every value occupies one word (two for numbers) in document order; containers
+		 * have a start and an end word that point at each other. All strings, including
+		 * keys, are stored length-prefixed in a single side buffer. The whole document
+		 * therefore lives in two allocations and is read through JsonValueView,
+		 * JsonArrayView and JsonObjectView.
+		 *
+		 * See JsonTapeTag for the word layout.
+		 */
+		class JsonTape
+		{
+		public:
+			/** Default constructor. Creates a tape holding a single null value. */
+			JsonTape();
+
+			/**
+			 * @brief Parses a JSON string into a tape.
+			 * @param input JSON text to parse. Does not have to outlive the tape.
+			 * @return The parsed tape.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonTape parse(std::string_view input);
+
+			/**
+			 * @brief Parses a JSON file into a tape.
+			 * @param file File object containing JSON data.
+			 * @return The parsed tape.
+			 * @throws JsonParserException if parsing fails.
+			 */
+			static JsonTape parse(const r_utils::io::File& file);
+
+			/**
+			 * @brief Copies a JsonElement tree into a tape.
+			 * @param element The value to copy. Does not have to outlive the tape.
+			 * @return A tape holding the same value.
+			 */
+			static JsonTape fromElement(const JsonElement& element);
+
+			/**
+			 * @brief Returns a view of the root value.
+			 * @return View that is valid as long as the tape is neither modified nor destroyed.
+			 */
+			[[nodiscard]] JsonValueView getRoot() const;
+
+			/** @brief Returns the tape words. */
+			[[nodiscard]] const std::vector<uint64_t>& getWords() const;
+			/** @brief Returns the string buffer. */
+			[[nodiscard]] const std::string& getStrings() const;
+
+		private:
+			friend class JsonTapeBuilder;
+
+			std::vector<uint64_t> words;
+			std::string strings;
+		};
+	} // json
+} // r_utils
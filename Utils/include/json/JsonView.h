@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include "json/JsonElement.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		class JsonArrayView;
+		class JsonObjectView;
+
+		/**
+		 * @enum JsonTapeTag
+		 * @brief Type tag stored in the top byte of every tape word.
+		 *
+		 * The lower 56 bits of a word hold the payload: for strings the offset of the string
+		 * in the string buffer, for containers the distance in words between the start and
+		 * end word (plus the element count in bits 32-55 of the start word). Numbers are
+		 * followed by a second word holding the raw value. All offsets are relative, so a
+		 * tape can be moved or mapped to any address.
+		 */
+		enum class JsonTapeTag : uint8_t {
+			Null = 'n',        /**< null */
+			True = 't',        /**< true */
+			False = 'f',       /**< false */
+			Int = 'i',         /**< Integer, value in the next word */
+			Double = 'd',      /**< Double, value in the next word */
+			String = '"',      /**< String, payload is the offset of its length prefix */
+			StartObject = '{', /**< Object start, followed by key/value pairs */
+			EndObject = '}',   /**< Object end */
+			StartArray = '[',  /**< Array start, followed by the elements */
+			EndArray = ']'     /**< Array end */
+		};
+
+		/**
+		 * @class JsonValueView
+		 * @brief Non-owning view of one value on a JSON tape.
+		 *
+		 * A view is two pointers: the tape word of the value and the string buffer. It mirrors
+		 * the isX()/asX() API of JsonElement, but navigation is pointer arithmetic over the
+		 * tape and nothing is copied. Views are only valid as long as the tape they point into.
+		 */
+		class JsonValueView
+		{
+		public:
+			/**
+			 * @brief Creates a view of the value at the given tape word.
+			 * @param word Tape word of the value.
+			 * @param strings Start of the string buffer of the tape.
+			 */
+			JsonValueView(const uint64_t* word, const char* strings);
+
+			[[nodiscard]] JsonType getType() const;
+
+			[[nodiscard]] bool isNull() const;
+			[[nodiscard]] bool isString() const;
+			[[nodiscard]] bool isInt() const;
+			[[nodiscard]] bool isDouble() const;
+			[[nodiscard]] bool isBoolean() const;
+			[[nodiscard]] bool isArray() const;
+			[[nodiscard]] bool isObject() const;
+
+			/** Returns the value as a string view. Throws if the type does not match. */
+			std::string_view asString() const;
+			/** Returns the value as an integer. Throws if the type does not match. */
+			int asInt() const;
+			/** Returns the value as a double. Throws if the type does not match. */
+			double asDouble() const;
+			/** Returns the value as a boolean. Throws if the type does not match. */
+			bool asBoolean() const;
+			/** Returns the value as an array view. Throws if the type does not match. */
+			JsonArrayView asArray() const;
+			/** Returns the value as an object view. Throws if the type does not match. */
+			JsonObjectView asObject() const;
+
+			/**
+			 * @brief Copies the value and all of its children into a JsonElement tree.
+			 * @return A JsonElement that no longer depends on the tape.
+			 */
+			JsonElement toElement() const;
+
+			/** @brief Returns the tape word following this value and all of its children. */
+			[[nodiscard]] const uint64_t* end() const;
+
+		private:
+			const uint64_t* word;
+			const char* strings;
+		};
+
+		/**
+		 * @class JsonArrayView
+		 * @brief Non-owning view of an array on a JSON tape.
+		 */
+		class JsonArrayView
+		{
+		public:
+			/**
+			 * @brief Forward iterator over the elements of an array view.
+			 */
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = JsonValueView;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = JsonValueView;
+
+				Iterator(const uint64_t* word, const char* strings);
+
+				JsonValueView operator*() const;
+				Iterator& operator++();
+				Iterator operator++(int);
+				bool operator==(const Iterator& other) const;
+				bool operator!=(const Iterator& other) const;
+
+			private:
+				const uint64_t* word;
+				const char* strings;
+			};
+
+			/**
+			 * @brief Creates a view of the array starting at the given tape word.
+			 * @param word StartArray word of the array.
+			 * @param strings Start of the string buffer of the tape.
+			 */
+			JsonArrayView(const uint64_t* word, const char* strings);
+
+			[[nodiscard]] size_t size() const;
+			[[nodiscard]] bool empty() const;
+
+			/**
+			 * @brief Accesses an element by index by skipping over the preceding elements.
+			 * @throws JsonArrayException if the index is out of range.
+			 */
+			JsonValueView get(size_t index) const;
+			JsonValueView operator[](size_t index) const;
+
+			[[nodiscard]] Iterator begin() const;
+			[[nodiscard]] Iterator end() const;
+
+		private:
+			const uint64_t* word;
+			const char* strings;
+		};
+
+		/**
+		 * @class JsonObjectView
+		 * @brief Non-owning view of an object on a JSON tape.
+		 *
+		 * Members are kept in document order and looked up by a linear scan that skips
+		 * over the values of non-matching keys.
+		 */
+		class JsonObjectView
+		{
+		public:
+			/**
+			 * @brief One key-value pair of an object view.
+			 */
+			struct Member
+			{
+				std::string_view key;
+				JsonValueView value;
+			};
+
+			/**
+			 * @brief Forward iterator over the members of an object view.
+			 */
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = Member;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = Member;
+
+				Iterator(const uint64_t* word, const char* strings);
+
+				Member operator*() const;
+				Iterator& operator++();
+				Iterator operator++(int);
+				bool operator==(const Iterator& other) const;
+				bool operator!=(const Iterator& other) const;
+
+			private:
+				const uint64_t* word;
+				const char* strings;
+			};
+
+			/**
+			 * @brief Creates a view of the object starting at the given tape word.
+			 * @param word StartObject word of the object.
+			 * @param strings Start of the string buffer of the tape.
+			 */
+			JsonObjectView(const uint64_t* word, const char* strings);
+
+			[[nodiscard]] size_t size() const;
+			[[nodiscard]] bool empty() const;
+
+			bool contains(std::string_view key) const;
+
+			/**
+			 * @brief Retrieves a member value by key.
+			 * @throws JsonObjectException if the key does not exist.
+			 */
+			JsonValueView get(std::string_view key) const;
+
+			[[nodiscard]] Iterator begin() const;
+			[[nodiscard]] Iterator end() const;
+
+		private:
+			const uint64_t* word;
+			const char* strings;
+		};
+	} // json
+} // r_utils
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <concepts>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "json/JsonElement.h"
+#include "json/JsonSerializer.h"
+#include "file/File.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonWriter
+		 * @brief Streams JSON text to a file or output stream without building a tree first.
+		 *
+		 * Values are appended to an internal buffer that is handed to the sink whenever it
+		 * grows past BUFFER_SIZE, so memory use stays constant regardless of the output size.
+		 * The writer checks that calls form a valid document (keys only inside objects,
+		 * every container closed) and throws JsonWriterException otherwise.
+		 *
+		 * @code
+		 * JsonWriter writer(File("report.json"));
+		 * writer.beginObject().key("rows").beginArray();
+		 * for (const Row& row : rows)
+		 *     writer.beginObject().key("id").value(row.id).endObject();
+		 * writer.endArray().endObject();
+		 * @endcode
+		 */
+		class JsonWriter
+		{
+		public:
+			/**
+			 * @brief Creates a writer that replaces the contents of a file.
+			 * @param file File to write to. Created if it does not exist.
+			 * @param prettyPrint If true, writes one member or element per line, indented with tabs.
+			 * @throws FileException if the file cannot be opened.
+			 */
+			explicit JsonWriter(const r_utils::io::File& file, bool prettyPrint = false);
+
+			/**
+			 * @brief Creates a writer that appends to an output stream.
+			 * @param out Stream to write to. Must outlive the writer.
+			 * @param prettyPrint If true, writes one member or element per line, indented with tabs.
+			 */
+			explicit JsonWriter(std::ostream& out, bool prettyPrint = false);
+
+			/** @brief Flushes all buffered output. */
+			~JsonWriter();
+
+			JsonWriter(const JsonWriter&) = delete;
+			JsonWriter& operator=(const JsonWriter&) = delete;
+
+			JsonWriter& beginObject();
+			JsonWriter& endObject();
+			JsonWriter& beginArray();
+			JsonWriter& endArray();
+
+			/**
+			 * @brief Writes the key of the next object member.
+			 * @throws JsonWriterException if not directly inside an object.
+			 */
+			JsonWriter& key(std::string_view name);
+
+			JsonWriter& value(std::string_view value);
+			JsonWriter& value(const char* value);
+			JsonWriter& value(const std::string& value);
+			/** @brief Writes any signed integer type, e.g. int, int64_t or ptrdiff_t, without rounding. */
+			template<std::signed_integral T>
+			JsonWriter& value(T value)
+			{
+				beforeValue();
+				JsonSerializer::appendNumber(buffer, static_cast<long long>(value));
+				afterValue();
+				return *this;
+			}
+			/** @brief Writes any unsigned integer type, e.g. unsigned, size_t or uint64_t, without rounding. */
+			template<std::unsigned_integral T> requires (!std::same_as<T, bool>)
+			JsonWriter& value(T value)
+			{
+				beforeValue();
+				JsonSerializer::appendNumber(buffer, static_cast<unsigned long long>(value));
+				afterValue();
+				return *this;
+			}
+			JsonWriter& value(double value);
+			JsonWriter& value(bool value);
+			JsonWriter& value(std::nullptr_t);
+			/** @brief Writes an existing value and all of its children. */
+			JsonWriter& value(const JsonElement& element);
+
+			/**
+			 * @brief Hands all buffered output to the sink and flushes it.
+			 * @throws JsonWriterException if the sink reports an error.
+			 */
+			void flush();
+
+			/** @brief Checks whether a complete top-level value has been written. */
+			[[nodiscard]] bool complete() const;
+
+			/** @brief Number of buffered bytes after which output is handed to the sink. */
+			static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+		private:
+			/**
+			 * @brief An open container.
+			 */
+			struct Frame
+			{
+				bool isObject;
+				bool empty = true;
+				bool hasKey = false;
+			};
+
+			void beforeValue();
+			void afterValue();
+			void newline(size_t level);
+			void drain();
+
+			std::ofstream file;
+			std::ostream& out;
+			std::string buffer;
+			JsonSerializer serializer;
+			std::vector<Frame> frames;
+			bool prettyPrint;
+			bool written = false;
+		};
+	} // json
+} // r_utils
@@ -37,9 +37,25 @@ namespace r_utils
                 throw r_utils::exception::FileException("Failed to open file: \"" + filePath + "\"");
             }
 
-            std::stringstream buffer;
-            buffer << in.rdbuf();
-            return buffer.str();
+            std::string buffer;
+
+            std::error_code error;
+            const auto size = std::filesystem::file_size(filePath, error);
+            if (!error && size > 0)
+            {
+                buffer.resize(static_cast<size_t>(size));
+                in.read(buffer.data(), static_cast<std::streamsize>(size));
+                buffer.resize(static_cast<size_t>(in.gcount()));
+            }
+
+            if (in.peek() != std::ifstream::traits_type::eof())
+            {
+                std::stringstream rest;
+                rest << in.rdbuf();
+                buffer += rest.str();
+            }
+
+            return buffer;
         }
 
         bool File::write(const std::string& content) const
@@ -0,0 +1,152 @@
+#include "file/MappedFile.h"
+
+#include "exception/file/FileException.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace r_utils
+{
+    namespace io
+    {
+
+#ifdef _WIN32
+        MappedFile::MappedFile(const File& file, Access access)
+        {
+            const DWORD flags = access == Access::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS;
+            HANDLE handle = CreateFileA(file.getFilePath().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+            if (handle == INVALID_HANDLE_VALUE)
+            {
+                throw r_utils::exception::FileException("Failed to open file: \"" + file.getFilePath() + "\"");
+            }
+            fileHandle = handle;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(handle, &fileSize))
+            {
+                release();
+                throw r_utils::exception::FileException("Failed to get size of file: \"" + file.getFilePath() + "\"");
+            }
+            size = static_cast<size_t>(fileSize.QuadPart);
+            if (size == 0)
+            {
+                return;
+            }
+
+            mappingHandle = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle != nullptr)
+            {
+                data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            }
+            if (data == nullptr)
+            {
+                release();
+                throw r_utils::exception::FileException("Failed to map file: \"" + file.getFilePath() + "\"");
+            }
+        }
+
+        void MappedFile::release()
+        {
+            if (data != nullptr) UnmapViewOfFile(data);
+            if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+            if (fileHandle != nullptr) CloseHandle(fileHandle);
+            data = nullptr;
+            mappingHandle = nullptr;
+            fileHandle = nullptr;
+            size = 0;
+        }
+#else
+        MappedFile::MappedFile(const File& file, Access access)
+        {
+            const int descriptor = ::open(file.getFilePath().c_str(), O_RDONLY);
+            if (descriptor < 0)
+            {
+                throw r_utils::exception::FileException("Failed to open file: \"" + file.getFilePath() + "\"");
+            }
+
+            struct stat status;
+            if (::fstat(descriptor, &status) != 0)
+            {
+                ::close(descriptor);
+                throw r_utils::exception::FileException("Failed to get size of file: \"" + file.getFilePath() + "\"");
+            }
+            size = static_cast<size_t>(status.st_size);
+            if (size == 0)
+            {
+                ::close(descriptor);
+                return;
+            }
+
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            // The mapping keeps its own reference to the file.
+            ::close(descriptor);
+            if (mapping == MAP_FAILED)
+            {
+                size = 0;
+                throw r_utils::exception::FileException("Failed to map file: \"" + file.getFilePath() + "\"");
+            }
+
+            data = static_cast<const char*>(mapping);
+            ::madvise(mapping, size, access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        }
+
+        void MappedFile::release()
+        {
+            if (data != nullptr)
+            {
+                ::munmap(const_cast<char*>(data), size);
+            }
+            data = nullptr;
+            size = 0;
+        }
+#endif
+
+        MappedFile::~MappedFile()
+        {
+            release();
+        }
+
+        MappedFile::MappedFile(MappedFile&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                data = std::exchange(other.data, nullptr);
+                size = std::exchange(other.size, 0);
+#ifdef _WIN32
+                fileHandle = std::exchange(other.fileHandle, nullptr);
+                mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+            }
+            return *this;
+        }
+
+        const char* MappedFile::getData() const
+        {
+            return data;
+        }
+
+        size_t MappedFile::getSize() const
+        {
+            return size;
+        }
+
+        std::string_view MappedFile::getView() const
+        {
+            return std::string_view(data, size);
+        }
+    } // io
+} // r_utils
\ No newline at end of file
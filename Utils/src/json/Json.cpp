@@ -13,7 +13,7 @@ namespace r_utils
         {}
 
 
-        Json Json::parse(const std::string& input)
+        Json Json::parse(std::string_view input)
         {
             return Json(JsonParser::parse(input));
         }
@@ -23,6 +23,21 @@ namespace r_utils
             return Json(JsonParser::parse(file));
         }
 
+        JsonLazyDocument Json::parseLazy(std::string_view input)
+        {
+            return JsonLazyDocument(input);
+        }
+
+        JsonLazyDocument Json::parseLazy(const r_utils::io::File& file)
+        {
+            return JsonLazyDocument(file);
+        }
+
+        JsonDocument Json::parseMapped(const r_utils::io::File& file)
+        {
+            return JsonDocument::parseMapped(file);
+        }
+
 
         bool Json::isObject() const
         {
@@ -35,12 +50,32 @@ namespace r_utils
         }
 
 
-        JsonObject Json::asObject() const
+        const JsonElement& Json::getRoot() const
+        {
+            return root;
+        }
+
+        JsonElement& Json::getRoot()
+        {
+            return root;
+        }
+
+        const JsonObject& Json::asObject() const
         {
             return root.asObject();
         }
 
-        JsonArray Json::asArray() const
+        JsonObject& Json::asObject()
+        {
+            return root.asObject();
+        }
+
+        const JsonArray& Json::asArray() const
+        {
+            return root.asArray();
+        }
+
+        JsonArray& Json::asArray()
         {
             return root.asArray();
         }
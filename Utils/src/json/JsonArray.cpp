@@ -1,8 +1,11 @@
 #include "json/JsonArray.h"
 #include "json/JsonElement.h"
+#include "json/JsonSerializer.h"
 
 #include "exception/json/JsonArrayException.h"
 
+#include <algorithm>
+
 
 namespace r_utils 
 {
@@ -15,6 +18,12 @@ namespace r_utils
 			return *this;
 		}
 
+		r_utils::json::JsonArray& JsonArray::add(r_utils::json::JsonElement&& element)
+		{
+			this->values.push_back(std::move(element));
+			return *this;
+		}
+
 		r_utils::json::JsonArray& JsonArray::remove(const r_utils::json::JsonElement& element)
 		{
 			auto size = values.size();
@@ -30,6 +39,31 @@ namespace r_utils
 			return *this;
 		}
 
+		r_utils::json::JsonArray& JsonArray::insert(int index, const r_utils::json::JsonElement& element)
+		{
+			return insert(index, JsonElement(element));
+		}
+
+		r_utils::json::JsonArray& JsonArray::insert(int index, r_utils::json::JsonElement&& element)
+		{
+			if (index < 0 || index > static_cast<int>(values.size()))
+			{
+				throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+			}
+			values.insert(values.begin() + index, std::move(element));
+			return *this;
+		}
+
+		r_utils::json::JsonArray& JsonArray::removeAt(int index)
+		{
+			if (index < 0 || index >= static_cast<int>(values.size()))
+			{
+				throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+			}
+			values.erase(values.begin() + index);
+			return *this;
+		}
+
 		const r_utils::json::JsonElement& JsonArray::get(int index) const
 		{
 			if (index < 0 || index >= static_cast<int>(values.size()))
@@ -39,6 +73,15 @@ namespace r_utils
 			return values.at(index);
 		}
 
+		r_utils::json::JsonElement& JsonArray::get(int index)
+		{
+			if (index < 0 || index >= static_cast<int>(values.size()))
+			{
+				throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+			}
+			return values.at(index);
+		}
+
 		size_t JsonArray::size() const
 		{
 			return this->values.size();
@@ -49,6 +92,11 @@ namespace r_utils
 			return this->size() == 0;
 		}
 
+		void JsonArray::reserve(size_t capacity)
+		{
+			this->values.reserve(capacity);
+		}
+
 		const std::vector<r_utils::json::JsonElement>& JsonArray::getValues() const
 		{
 			return this->values;
@@ -56,34 +104,9 @@ namespace r_utils
 
 		const std::string JsonArray::toString() const
 		{
-			std::stringstream ss;
-
-			ss << "[";
-
-			size_t counter = 0;
-			for (auto& it : this->getValues())
-			{
-				switch (it.getType())
-				{
-					case JsonType::String: ss << "\"" << it.asString() << "\""; break;
-					case JsonType::Int: ss << it.asInt(); break;
-					case JsonType::Double: ss << it.asDouble(); break;
-					case JsonType::Boolean: ss << (it.asBoolean() ? "true" : "false"); break;
-					case JsonType::Array: ss << it.asArray().toString(); break;
-					case JsonType::Object: ss << it.asObject().toString(); break;
-					case JsonType::Null: ss << "null"; break;
-				}
-
-				counter++;
-
-				if (counter < this->size())
-				{
-					ss << ",";
-				}
-			}
-
-			ss << "]";
-			return ss.str();
+			JsonSerializer serializer;
+			serializer.write(*this);
+			return serializer.take();
 		}
 
 		const r_utils::json::JsonElement& JsonArray::operator[](int index) const
@@ -91,6 +114,11 @@ namespace r_utils
 			return this->get(index);
 		}
 
+		r_utils::json::JsonElement& JsonArray::operator[](int index)
+		{
+			return this->get(index);
+		}
+
 
 		std::ostream& operator<<(std::ostream& os, const r_utils::json::JsonArray& arr)
 		{
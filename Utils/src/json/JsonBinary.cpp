@@ -0,0 +1,717 @@
+#include "json/JsonBinary.h"
+#include "json/JsonElementBuilder.h"
+
+#include "exception/json/JsonParserException.h"
+#include "exception/json/JsonWriterException.h"
+
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonByteSink
+		 * @brief Output buffer that is handed to a stream whenever it grows past BUFFER_SIZE.
+		 */
+		class JsonByteSink
+		{
+		public:
+			explicit JsonByteSink(std::ostream* out = nullptr)
+				: out(out)
+			{}
+
+			void put(uint8_t byte)
+			{
+				buffer += static_cast<char>(byte);
+				if (out != nullptr && buffer.size() >= BUFFER_SIZE) drain();
+			}
+
+			void put(std::string_view bytes)
+			{
+				buffer.append(bytes);
+				if (out != nullptr && buffer.size() >= BUFFER_SIZE) drain();
+			}
+
+			/** @brief Appends the lowest count bytes of value, most significant first. */
+			void putBigEndian(uint64_t value, int count)
+			{
+				for (int shift = (count - 1) * 8; shift >= 0; shift -= 8)
+				{
+					buffer += static_cast<char>(value >> shift);
+				}
+				if (out != nullptr && buffer.size() >= BUFFER_SIZE) drain();
+			}
+
+			void drain()
+			{
+				out->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				if (!*out)
+				{
+					throw r_utils::exception::JsonWriterException("Failed to write binary JSON to stream");
+				}
+				buffer.clear();
+			}
+
+			std::string& getBuffer()
+			{
+				return buffer;
+			}
+
+			static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+		private:
+			std::ostream* out;
+			std::string buffer;
+		};
+
+		/**
+		 * @class JsonByteSource
+		 * @brief Reads bytes from a buffer, or from a stream without reading past the current value.
+		 */
+		class JsonByteSource
+		{
+		public:
+			explicit JsonByteSource(std::string_view data)
+				: data(data)
+			{}
+
+			explicit JsonByteSource(std::istream& in)
+				: stream(in.rdbuf())
+			{}
+
+			uint8_t get()
+			{
+				if (stream != nullptr)
+				{
+					const auto c = stream->sbumpc();
+					if (c == std::char_traits<char>::eof()) truncated();
+					return static_cast<uint8_t>(c);
+				}
+
+				if (position >= data.size()) truncated();
+				return static_cast<uint8_t>(data[position++]);
+			}
+
+			uint64_t getBigEndian(int count)
+			{
+				uint64_t value = 0;
+				for (int i = 0; i < count; ++i)
+				{
+					value = (value << 8) | get();
+				}
+				return value;
+			}
+
+			/**
+			 * @brief Reads count bytes.
+			 * @return A view that stays valid until the next call.
+			 */
+			std::string_view getBytes(uint64_t count)
+			{
+				if (stream == nullptr)
+				{
+					if (count > data.size() - position) truncated();
+					std::string_view bytes = data.substr(position, count);
+					position += count;
+					return bytes;
+				}
+
+				// Grow with the data actually received, so a corrupt length cannot allocate gigabytes.
+				scratch.clear();
+				while (scratch.size() < count)
+				{
+					const size_t chunk = static_cast<size_t>(std::min<uint64_t>(count - scratch.size(), 64 * 1024));
+					const size_t offset = scratch.size();
+					scratch.resize(offset + chunk);
+					if (stream->sgetn(scratch.data() + offset, static_cast<std::streamsize>(chunk)) != static_cast<std::streamsize>(chunk)) truncated();
+				}
+				return scratch;
+			}
+
+			/** @brief Buffer for assembling strings that arrive in chunks. */
+			std::string& getJoinBuffer()
+			{
+				return joined;
+			}
+
+		private:
+			[[noreturn]] static void truncated()
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input");
+			}
+
+			std::string_view data;
+			size_t position = 0;
+			std::streambuf* stream = nullptr;
+			std::string scratch;
+			std::string joined;
+		};
+
+
+		/** @brief Returns true if the double survives a round trip through float. */
+		static bool fitsFloat(double value)
+		{
+			return std::isnan(value) || static_cast<double>(static_cast<float>(value)) == value;
+		}
+
+
+		// ---- CBOR ----------------------------------------------------------------
+
+		static void cborHead(JsonByteSink& sink, uint8_t major, uint64_t value)
+		{
+			const uint8_t type = static_cast<uint8_t>(major << 5);
+			if (value < 24) sink.put(type | static_cast<uint8_t>(value));
+			else if (value <= 0xFF) { sink.put(type | 24); sink.putBigEndian(value, 1); }
+			else if (value <= 0xFFFF) { sink.put(type | 25); sink.putBigEndian(value, 2); }
+			else if (value <= 0xFFFFFFFF) { sink.put(type | 26); sink.putBigEndian(value, 4); }
+			else { sink.put(type | 27); sink.putBigEndian(value, 8); }
+		}
+
+		static void cborString(JsonByteSink& sink, std::string_view value)
+		{
+			cborHead(sink, 3, value.size());
+			sink.put(value);
+		}
+
+		static void cborEncode(JsonByteSink& sink, const JsonElement& element);
+
+		static void cborEncode(JsonByteSink& sink, const JsonArray& array)
+		{
+			cborHead(sink, 4, array.size());
+			for (const JsonElement& value : array.getValues())
+			{
+				cborEncode(sink, value);
+			}
+		}
+
+		static void cborEncode(JsonByteSink& sink, const JsonObject& object)
+		{
+			cborHead(sink, 5, object.size());
+			for (const auto& [key, value] : object)
+			{
+				cborString(sink, key);
+				cborEncode(sink, value);
+			}
+		}
+
+		static void cborEncode(JsonByteSink& sink, const JsonElement& element)
+		{
+			switch (element.getType())
+			{
+				case JsonType::Null: sink.put(0xF6); break;
+				case JsonType::Boolean: sink.put(element.asBoolean() ? 0xF5 : 0xF4); break;
+				case JsonType::Int:
+				{
+					const int64_t value = element.asInt();
+					if (value >= 0) cborHead(sink, 0, static_cast<uint64_t>(value));
+					else cborHead(sink, 1, static_cast<uint64_t>(-(value + 1)));
+					break;
+				}
+				case JsonType::Double:
+				{
+					const double value = element.asDouble();
+					if (fitsFloat(value))
+					{
+						sink.put(0xFA);
+						sink.putBigEndian(std::bit_cast<uint32_t>(static_cast<float>(value)), 4);
+					}
+					else
+					{
+						sink.put(0xFB);
+						sink.putBigEndian(std::bit_cast<uint64_t>(value), 8);
+					}
+					break;
+				}
+				case JsonType::String: cborString(sink, element.asString()); break;
+				case JsonType::Array: cborEncode(sink, element.asArray()); break;
+				case JsonType::Object: cborEncode(sink, element.asObject()); break;
+			}
+		}
+
+
+		/**
+		 * @brief One decoded item: a scalar, or the header of an array or object.
+		 */
+		struct JsonBinaryToken
+		{
+			/** Int fits into an int, Int64 into an int64_t and Uint64 only into a uint64_t. */
+			enum class Kind { Null, Boolean, Int, Int64, Uint64, Double, String, Array, Object, Break };
+
+			Kind kind;
+			bool boolean = false;
+			/** Value of Int and Int64 tokens. */
+			int64_t intValue = 0;
+			/** Value of Uint64 tokens. */
+			uint64_t uintValue = 0;
+			double doubleValue = 0;
+			/** String contents; valid until the next token is read. */
+			std::string_view text{};
+			/** Number of elements or members of a container. */
+			uint64_t count = 0;
+			/** True for containers whose end is marked by a Break token. */
+			bool indefinite = false;
+		};
+
+		static JsonBinaryToken makeSigned(int64_t value)
+		{
+			JsonBinaryToken token{ value >= INT_MIN && value <= INT_MAX ? JsonBinaryToken::Kind::Int : JsonBinaryToken::Kind::Int64 };
+			token.intValue = value;
+			return token;
+		}
+
+		static JsonBinaryToken makeUnsigned(uint64_t value)
+		{
+			if (value <= static_cast<uint64_t>(INT64_MAX))
+			{
+				return makeSigned(static_cast<int64_t>(value));
+			}
+			JsonBinaryToken token{ JsonBinaryToken::Kind::Uint64 };
+			token.uintValue = value;
+			return token;
+		}
+
+		static JsonBinaryToken makeDouble(double value)
+		{
+			JsonBinaryToken token{ JsonBinaryToken::Kind::Double };
+			token.doubleValue = value;
+			return token;
+		}
+
+		static JsonBinaryToken makeString(std::string_view text)
+		{
+			JsonBinaryToken token{ JsonBinaryToken::Kind::String };
+			token.text = text;
+			return token;
+		}
+
+		static JsonBinaryToken makeContainer(JsonBinaryToken::Kind kind, uint64_t count, bool indefinite = false)
+		{
+			JsonBinaryToken token{ kind };
+			token.count = count;
+			token.indefinite = indefinite;
+			return token;
+		}
+
+		/** @brief Converts an IEEE 754 half-precision float. */
+		static double halfToDouble(uint16_t half)
+		{
+			const int exponent = (half >> 10) & 0x1F;
+			const int mantissa = half & 0x3FF;
+			double value;
+			if (exponent == 0) value = std::ldexp(mantissa, -24);
+			else if (exponent != 31) value = std::ldexp(mantissa + 1024, exponent - 25);
+			else value = mantissa == 0 ? INFINITY : NAN;
+			return (half & 0x8000) ? -value : value;
+		}
+
+		/** @brief Additional information value that marks an indefinite length. */
+		static constexpr uint8_t CBOR_INDEFINITE = 31;
+
+		/** @brief Reads the argument of a head with the given additional information. */
+		static uint64_t cborArgument(JsonByteSource& source, uint8_t info)
+		{
+			if (info < 24) return info;
+			if (info == 24) return source.getBigEndian(1);
+			if (info == 25) return source.getBigEndian(2);
+			if (info == 26) return source.getBigEndian(4);
+			if (info == 27) return source.getBigEndian(8);
+			throw r_utils::exception::JsonParserException("Invalid CBOR additional information: " + std::to_string(info));
+		}
+
+		/** @brief Reads a byte or text string whose initial byte has already been read. */
+		static std::string_view cborText(JsonByteSource& source, uint8_t major, uint8_t info)
+		{
+			if (info != CBOR_INDEFINITE)
+			{
+				return source.getBytes(cborArgument(source, info));
+			}
+
+			// Indefinite length: definite chunks of the same major type up to a break.
+			std::string& joined = source.getJoinBuffer();
+			joined.clear();
+			while (true)
+			{
+				const uint8_t initial = source.get();
+				if (initial == 0xFF) return joined;
+				if ((initial >> 5) != major || (initial & 0x1F) == CBOR_INDEFINITE)
+				{
+					throw r_utils::exception::JsonParserException("Invalid chunk in indefinite-length CBOR string");
+				}
+				joined.append(source.getBytes(cborArgument(source, initial & 0x1F)));
+			}
+		}
+
+		static JsonBinaryToken cborToken(JsonByteSource& source)
+		{
+			uint8_t initial = source.get();
+			while ((initial >> 5) == 6)
+			{
+				// Tags only annotate the item that follows.
+				if ((initial & 0x1F) == CBOR_INDEFINITE)
+				{
+					throw r_utils::exception::JsonParserException("Invalid indefinite length for a CBOR tag");
+				}
+				cborArgument(source, initial & 0x1F);
+				initial = source.get();
+			}
+
+			const uint8_t major = initial >> 5;
+			const uint8_t info = initial & 0x1F;
+			switch (major)
+			{
+				case 0:
+				case 1:
+				{
+					if (info == CBOR_INDEFINITE)
+					{
+						throw r_utils::exception::JsonParserException("Invalid indefinite length for a CBOR integer");
+					}
+					const uint64_t argument = cborArgument(source, info);
+					if (major == 0) return makeUnsigned(argument);
+					if (argument <= static_cast<uint64_t>(INT64_MAX)) return makeSigned(-1 - static_cast<int64_t>(argument));
+					return makeDouble(-1.0 - static_cast<double>(argument));
+				}
+				case 2:
+				case 3:
+					return makeString(cborText(source, major, info));
+				case 4:
+				case 5:
+				{
+					const JsonBinaryToken::Kind kind = major == 4 ? JsonBinaryToken::Kind::Array : JsonBinaryToken::Kind::Object;
+					if (info == CBOR_INDEFINITE) return makeContainer(kind, 0, true);
+					return makeContainer(kind, cborArgument(source, info));
+				}
+				default:
+					break;
+			}
+
+			switch (info)
+			{
+				case 20: case 21:
+				{
+					JsonBinaryToken token{ JsonBinaryToken::Kind::Boolean };
+					token.boolean = info == 21;
+					return token;
+				}
+				case 22: case 23: return JsonBinaryToken{ JsonBinaryToken::Kind::Null };
+				case 25: return makeDouble(halfToDouble(static_cast<uint16_t>(source.getBigEndian(2))));
+				case 26: return makeDouble(std::bit_cast<float>(static_cast<uint32_t>(source.getBigEndian(4))));
+				case 27: return makeDouble(std::bit_cast<double>(source.getBigEndian(8)));
+				case 31: return JsonBinaryToken{ JsonBinaryToken::Kind::Break };
+				default: throw r_utils::exception::JsonParserException("Unsupported CBOR simple value: " + std::to_string(info));
+			}
+		}
+
+
+		// ---- MessagePack ---------------------------------------------------------
+
+		static void msgpackHead(JsonByteSink& sink, uint64_t size, uint8_t fixBase, uint8_t fixLimit, uint8_t type8, uint8_t type16, uint8_t type32)
+		{
+			if (size < fixLimit) sink.put(fixBase | static_cast<uint8_t>(size));
+			else if (type8 != 0 && size <= 0xFF) { sink.put(type8); sink.putBigEndian(size, 1); }
+			else if (size <= 0xFFFF) { sink.put(type16); sink.putBigEndian(size, 2); }
+			else if (size <= 0xFFFFFFFF) { sink.put(type32); sink.putBigEndian(size, 4); }
+			else throw r_utils::exception::JsonWriterException("Value too large for MessagePack: " + std::to_string(size));
+		}
+
+		static void msgpackString(JsonByteSink& sink, std::string_view value)
+		{
+			msgpackHead(sink, value.size(), 0xA0, 32, 0xD9, 0xDA, 0xDB);
+			sink.put(value);
+		}
+
+		static void msgpackEncode(JsonByteSink& sink, const JsonElement& element);
+
+		static void msgpackEncode(JsonByteSink& sink, const JsonArray& array)
+		{
+			msgpackHead(sink, array.size(), 0x90, 16, 0, 0xDC, 0xDD);
+			for (const JsonElement& value : array.getValues())
+			{
+				msgpackEncode(sink, value);
+			}
+		}
+
+		static void msgpackEncode(JsonByteSink& sink, const JsonObject& object)
+		{
+			msgpackHead(sink, object.size(), 0x80, 16, 0, 0xDE, 0xDF);
+			for (const auto& [key, value] : object)
+			{
+				msgpackString(sink, key);
+				msgpackEncode(sink, value);
+			}
+		}
+
+		static void msgpackEncode(JsonByteSink& sink, const JsonElement& element)
+		{
+			switch (element.getType())
+			{
+				case JsonType::Null: sink.put(0xC0); break;
+				case JsonType::Boolean: sink.put(element.asBoolean() ? 0xC3 : 0xC2); break;
+				case JsonType::Int:
+				{
+					const int value = element.asInt();
+					if (value >= -32 && value <= 127) sink.put(static_cast<uint8_t>(value));
+					else if (value >= 0 && value <= 0xFF) { sink.put(0xCC); sink.putBigEndian(value, 1); }
+					else if (value >= 0 && value <= 0xFFFF) { sink.put(0xCD); sink.putBigEndian(value, 2); }
+					else if (value >= 0) { sink.put(0xCE); sink.putBigEndian(value, 4); }
+					else if (value >= INT8_MIN) { sink.put(0xD0); sink.putBigEndian(static_cast<uint8_t>(value), 1); }
+					else if (value >= INT16_MIN) { sink.put(0xD1); sink.putBigEndian(static_cast<uint16_t>(value), 2); }
+					else { sink.put(0xD2); sink.putBigEndian(static_cast<uint32_t>(value), 4); }
+					break;
+				}
+				case JsonType::Double:
+				{
+					const double value = element.asDouble();
+					if (fitsFloat(value))
+					{
+						sink.put(0xCA);
+						sink.putBigEndian(std::bit_cast<uint32_t>(static_cast<float>(value)), 4);
+					}
+					else
+					{
+						sink.put(0xCB);
+						sink.putBigEndian(std::bit_cast<uint64_t>(value), 8);
+					}
+					break;
+				}
+				case JsonType::String: msgpackString(sink, element.asString()); break;
+				case JsonType::Array: msgpackEncode(sink, element.asArray()); break;
+				case JsonType::Object: msgpackEncode(sink, element.asObject()); break;
+			}
+		}
+
+
+		static JsonBinaryToken msgpackToken(JsonByteSource& source)
+		{
+			const uint8_t initial = source.get();
+
+			if (initial <= 0x7F) return makeSigned(initial);
+			if (initial >= 0xE0) return makeSigned(static_cast<int8_t>(initial));
+			if ((initial & 0xE0) == 0xA0) return makeString(source.getBytes(initial & 0x1F));
+			if ((initial & 0xF0) == 0x90) return makeContainer(JsonBinaryToken::Kind::Array, initial & 0x0F);
+			if ((initial & 0xF0) == 0x80) return makeContainer(JsonBinaryToken::Kind::Object, initial & 0x0F);
+
+			switch (initial)
+			{
+				case 0xC0: return JsonBinaryToken{ JsonBinaryToken::Kind::Null };
+				case 0xC2: case 0xC3:
+				{
+					JsonBinaryToken token{ JsonBinaryToken::Kind::Boolean };
+					token.boolean = initial == 0xC3;
+					return token;
+				}
+				case 0xC4: case 0xD9: return makeString(source.getBytes(source.getBigEndian(1)));
+				case 0xC5: case 0xDA: return makeString(source.getBytes(source.getBigEndian(2)));
+				case 0xC6: case 0xDB: return makeString(source.getBytes(source.getBigEndian(4)));
+				case 0xCA: return makeDouble(std::bit_cast<float>(static_cast<uint32_t>(source.getBigEndian(4))));
+				case 0xCB: return makeDouble(std::bit_cast<double>(source.getBigEndian(8)));
+				case 0xCC: return makeUnsigned(source.getBigEndian(1));
+				case 0xCD: return makeUnsigned(source.getBigEndian(2));
+				case 0xCE: return makeUnsigned(source.getBigEndian(4));
+				case 0xCF: return makeUnsigned(source.getBigEndian(8));
+				case 0xD0: return makeSigned(static_cast<int8_t>(source.getBigEndian(1)));
+				case 0xD1: return makeSigned(static_cast<int16_t>(source.getBigEndian(2)));
+				case 0xD2: return makeSigned(static_cast<int32_t>(source.getBigEndian(4)));
+				case 0xD3: return makeSigned(static_cast<int64_t>(source.getBigEndian(8)));
+				case 0xDC: return makeContainer(JsonBinaryToken::Kind::Array, source.getBigEndian(2));
+				case 0xDD: return makeContainer(JsonBinaryToken::Kind::Array, source.getBigEndian(4));
+				case 0xDE: return makeContainer(JsonBinaryToken::Kind::Object, source.getBigEndian(2));
+				case 0xDF: return makeContainer(JsonBinaryToken::Kind::Object, source.getBigEndian(4));
+				default: throw r_utils::exception::JsonParserException("Unsupported MessagePack type: " + std::to_string(initial));
+			}
+		}
+
+
+		// ---- Decoding ------------------------------------------------------------
+
+		using JsonTokenReader = JsonBinaryToken (*)(JsonByteSource&);
+
+		/**
+		 * @brief Reads the next element or member of a container.
+		 * @return False once the container is complete.
+		 */
+		static bool nextItem(JsonByteSource& source, JsonTokenReader read, const JsonBinaryToken& container, uint64_t index, JsonBinaryToken& item)
+		{
+			if (!container.indefinite && index == container.count)
+			{
+				return false;
+			}
+
+			item = read(source);
+			if (item.kind == JsonBinaryToken::Kind::Break)
+			{
+				if (!container.indefinite)
+				{
+					throw r_utils::exception::JsonParserException("Unexpected break");
+				}
+				return false;
+			}
+			if (container.kind == JsonBinaryToken::Kind::Object && item.kind != JsonBinaryToken::Kind::String)
+			{
+				throw r_utils::exception::JsonParserException("Map keys must be strings");
+			}
+			return true;
+		}
+
+		static void emitValue(JsonByteSource& source, JsonTokenReader read, IJsonHandler& handler, const JsonBinaryToken& token)
+		{
+			JsonBinaryToken item;
+			switch (token.kind)
+			{
+				case JsonBinaryToken::Kind::Null: handler.onNull(); break;
+				case JsonBinaryToken::Kind::Boolean: handler.onBoolean(token.boolean); break;
+				case JsonBinaryToken::Kind::Int: handler.onInt(static_cast<int>(token.intValue)); break;
+				case JsonBinaryToken::Kind::Int64: handler.onInt64(token.intValue); break;
+				case JsonBinaryToken::Kind::Uint64: handler.onUint64(token.uintValue); break;
+				case JsonBinaryToken::Kind::Double: handler.onNumber(token.doubleValue); break;
+				case JsonBinaryToken::Kind::String: handler.onString(token.text); break;
+				case JsonBinaryToken::Kind::Array:
+					handler.onStartArray();
+					for (uint64_t i = 0; nextItem(source, read, token, i, item); ++i)
+					{
+						emitValue(source, read, handler, item);
+					}
+					handler.onEndArray();
+					break;
+				case JsonBinaryToken::Kind::Object:
+					handler.onStartObject();
+					for (uint64_t i = 0; nextItem(source, read, token, i, item); ++i)
+					{
+						handler.onKey(item.text);
+						emitValue(source, read, handler, read(source));
+					}
+					handler.onEndObject();
+					break;
+				case JsonBinaryToken::Kind::Break:
+					throw r_utils::exception::JsonParserException("Unexpected break");
+			}
+		}
+
+		static JsonElement buildValue(JsonByteSource& source, JsonTokenReader read, const JsonBinaryToken& token)
+		{
+			JsonBinaryToken item;
+			switch (token.kind)
+			{
+				case JsonBinaryToken::Kind::Null: return JsonElement(nullptr);
+				case JsonBinaryToken::Kind::Boolean: return JsonElement(token.boolean);
+				case JsonBinaryToken::Kind::Int: return JsonElement(static_cast<int>(token.intValue));
+				// Like JsonParser, the DOM keeps integers beyond the int range as Double.
+				case JsonBinaryToken::Kind::Int64: return JsonElement(static_cast<double>(token.intValue));
+				case JsonBinaryToken::Kind::Uint64: return JsonElement(static_cast<double>(token.uintValue));
+				case JsonBinaryToken::Kind::Double: return JsonElement(token.doubleValue);
+				case JsonBinaryToken::Kind::String: return JsonElement(std::string(token.text));
+				case JsonBinaryToken::Kind::Array:
+				{
+					JsonArray array;
+					for (uint64_t i = 0; nextItem(source, read, token, i, item); ++i)
+					{
+						array.add(buildValue(source, read, item));
+					}
+					return JsonElement(std::move(array));
+				}
+				case JsonBinaryToken::Kind::Object:
+				{
+					JsonObject object;
+					for (uint64_t i = 0; nextItem(source, read, token, i, item); ++i)
+					{
+						JsonKey key(item.text);
+						object.set(key, buildValue(source, read, read(source)));
+					}
+					return JsonElement(std::move(object));
+				}
+				default:
+					throw r_utils::exception::JsonParserException("Unexpected break");
+			}
+		}
+
+
+		// ---- Public interface ----------------------------------------------------
+
+		template<typename Value>
+		static std::string encodeToString(const Value& value, void (*encoder)(JsonByteSink&, const Value&))
+		{
+			JsonByteSink sink;
+			encoder(sink, value);
+			return std::move(sink.getBuffer());
+		}
+
+		template<typename Value>
+		static void encodeToStream(const Value& value, std::ostream& out, void (*encoder)(JsonByteSink&, const Value&))
+		{
+			JsonByteSink sink(&out);
+			encoder(sink, value);
+			sink.drain();
+		}
+
+
+		std::string JsonCbor::encode(const JsonElement& element) { return encodeToString<JsonElement>(element, &cborEncode); }
+		std::string JsonCbor::encode(const JsonObject& object) { return encodeToString<JsonObject>(object, &cborEncode); }
+		std::string JsonCbor::encode(const JsonArray& array) { return encodeToString<JsonArray>(array, &cborEncode); }
+
+		void JsonCbor::encode(const JsonElement& element, std::ostream& out) { encodeToStream<JsonElement>(element, out, &cborEncode); }
+		void JsonCbor::encode(const JsonObject& object, std::ostream& out) { encodeToStream<JsonObject>(object, out, &cborEncode); }
+		void JsonCbor::encode(const JsonArray& array, std::ostream& out) { encodeToStream<JsonArray>(array, out, &cborEncode); }
+
+		JsonElement JsonCbor::decode(std::string_view data)
+		{
+			JsonByteSource source(data);
+			return buildValue(source, &cborToken, cborToken(source));
+		}
+
+		JsonElement JsonCbor::decode(std::istream& in)
+		{
+			JsonByteSource source(in);
+			return buildValue(source, &cborToken, cborToken(source));
+		}
+
+		void JsonCbor::decode(std::string_view data, IJsonHandler& handler)
+		{
+			JsonByteSource source(data);
+			emitValue(source, &cborToken, handler, cborToken(source));
+		}
+
+		void JsonCbor::decode(std::istream& in, IJsonHandler& handler)
+		{
+			JsonByteSource source(in);
+			emitValue(source, &cborToken, handler, cborToken(source));
+		}
+
+
+		std::string JsonMessagePack::encode(const JsonElement& element) { return encodeToString<JsonElement>(element, &msgpackEncode); }
+		std::string JsonMessagePack::encode(const JsonObject& object) { return encodeToString<JsonObject>(object, &msgpackEncode); }
+		std::string JsonMessagePack::encode(const JsonArray& array) { return encodeToString<JsonArray>(array, &msgpackEncode); }
+
+		void JsonMessagePack::encode(const JsonElement& element, std::ostream& out) { encodeToStream<JsonElement>(element, out, &msgpackEncode); }
+		void JsonMessagePack::encode(const JsonObject& object, std::ostream& out) { encodeToStream<JsonObject>(object, out, &msgpackEncode); }
+		void JsonMessagePack::encode(const JsonArray& array, std::ostream& out) { encodeToStream<JsonArray>(array, out, &msgpackEncode); }
+
+		JsonElement JsonMessagePack::decode(std::string_view data)
+		{
+			JsonByteSource source(data);
+			return buildValue(source, &msgpackToken, msgpackToken(source));
+		}
+
+		JsonElement JsonMessagePack::decode(std::istream& in)
+		{
+			JsonByteSource source(in);
+			return buildValue(source, &msgpackToken, msgpackToken(source));
+		}
+
+		void JsonMessagePack::decode(std::string_view data, IJsonHandler& handler)
+		{
+			JsonByteSource source(data);
+			emitValue(source, &msgpackToken, handler, msgpackToken(source));
+		}
+
+		void JsonMessagePack::decode(std::istream& in, IJsonHandler& handler)
+		{
+			JsonByteSource source(in);
+			emitValue(source, &msgpackToken, handler, msgpackToken(source));
+		}
+	} // json
+} // r_utils
\ No newline at end of file
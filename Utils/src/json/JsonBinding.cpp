@@ -0,0 +1,189 @@
+#include "json/JsonBinding.h"
+#include "json/JsonParser.h"
+#include "json/IJsonHandler.h"
+
+#include "exception/json/JsonParserException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonBindingReader
+		 * @brief Routes parse events to the JsonBindingOps of the value being read.
+		 */
+		class JsonBindingReader : public IJsonHandler
+		{
+		public:
+			explicit JsonBindingReader(JsonBindingTarget root)
+				: root(root)
+			{}
+
+			void onStartObject() override
+			{
+				if (skipDepth > 0)
+				{
+					skipDepth++;
+					return;
+				}
+
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr)
+				{
+					skipDepth = 1;
+					return;
+				}
+				if (target.ops->onStartObject == nullptr) mismatch(target, "an object");
+				frames.push_back(Frame{ target.ops->onStartObject(target.object), false });
+			}
+
+			void onKey(std::string_view key) override
+			{
+				if (skipDepth > 0) return;
+
+				const JsonBindingTarget& object = frames.back().target;
+				pending = object.ops->onKey(object.object, key);
+			}
+
+			void onEndObject() override
+			{
+				if (skipDepth > 0) skipDepth--;
+				else frames.pop_back();
+			}
+
+			void onStartArray() override
+			{
+				if (skipDepth > 0)
+				{
+					skipDepth++;
+					return;
+				}
+
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr)
+				{
+					skipDepth = 1;
+					return;
+				}
+				if (target.ops->onStartArray == nullptr) mismatch(target, "an array");
+				frames.push_back(Frame{ target.ops->onStartArray(target.object), true });
+			}
+
+			void onEndArray() override
+			{
+				if (skipDepth > 0) skipDepth--;
+				else frames.pop_back();
+			}
+
+			void onString(std::string_view value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onString == nullptr) mismatch(target, "a string");
+				target.ops->onString(target.object, value);
+			}
+
+			void onNumber(double value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onNumber == nullptr) mismatch(target, "a number");
+				target.ops->onNumber(target.object, value);
+			}
+
+			void onInt(int value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onInt == nullptr) mismatch(target, "a number");
+				target.ops->onInt(target.object, value);
+			}
+
+			void onInt64(int64_t value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onInt64 == nullptr) mismatch(target, "a number");
+				target.ops->onInt64(target.object, value);
+			}
+
+			void onUint64(uint64_t value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onUint64 == nullptr) mismatch(target, "a number");
+				target.ops->onUint64(target.object, value);
+			}
+
+			void onBoolean(bool value) override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr) return;
+				if (target.ops->onBoolean == nullptr) mismatch(target, "a boolean");
+				target.ops->onBoolean(target.object, value);
+			}
+
+			void onNull() override
+			{
+				if (skipDepth > 0) return;
+				const JsonBindingTarget target = destination();
+				if (target.ops == nullptr || target.ops->onNull == nullptr)
+				{
+					// Null leaves non-optional fields untouched.
+					return;
+				}
+				target.ops->onNull(target.object);
+			}
+
+		private:
+			/** An open object or array. */
+			struct Frame
+			{
+				JsonBindingTarget target;
+				bool isArray;
+			};
+
+			/** @brief Returns the target of the value that starts now. */
+			JsonBindingTarget destination()
+			{
+				if (frames.empty())
+				{
+					return root;
+				}
+
+				const JsonBindingTarget& container = frames.back().target;
+				return frames.back().isArray ? container.ops->onElement(container.object) : pending;
+			}
+
+			[[noreturn]] static void mismatch(const JsonBindingTarget& target, const char* actual)
+			{
+				throw r_utils::exception::JsonBindingException(std::string("Expected ") + target.ops->expected + ", got " + actual);
+			}
+
+			JsonBindingTarget root;
+			JsonBindingTarget pending{ nullptr, nullptr };
+			std::vector<Frame> frames;
+			/** Depth inside a value that is being skipped, 0 if none. */
+			size_t skipDepth = 0;
+		};
+
+
+		void JsonBinding::read(std::string_view input, JsonBindingTarget root)
+		{
+			JsonBindingReader reader(root);
+			JsonParser::parse(input, reader);
+		}
+
+		void JsonBinding::read(const r_utils::io::File& file, JsonBindingTarget root)
+		{
+			JsonBindingReader reader(root);
+			JsonParser::parse(file, reader);
+		}
+	} // json
+} // r_utils
\ No newline at end of file
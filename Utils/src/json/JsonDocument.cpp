@@ -0,0 +1,403 @@
+#include "json/JsonDocument.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonArrayException.h"
+#include "exception/json/JsonElementException.h"
+#include "exception/json/JsonObjectException.h"
+#include "exception/json/JsonParserException.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonDocumentBuilder
+		 * @brief Turns parse events into arena nodes.
+		 *
+		 * Children of open containers are collected on reusable scratch stacks and copied
+		 * into one contiguous arena block when their container closes. Strings that point
+		 * into the borrowed input (those without escapes) are referenced instead of copied.
+		 */
+		class JsonDocumentBuilder : public IJsonHandler
+		{
+		public:
+			explicit JsonDocumentBuilder(std::pmr::memory_resource& arena, std::string_view borrowed = {})
+				: arena(arena), borrowed(borrowed)
+			{}
+
+			void onStartObject() override
+			{
+				frames.push_back(Frame{ true, members.size(), {} });
+			}
+
+			void onKey(std::string_view key) override
+			{
+				frames.back().key = copyString(key);
+			}
+
+			void onEndObject() override
+			{
+				const Frame frame = frames.back();
+				frames.pop_back();
+
+				JsonNode node;
+				node.type = JsonType::Object;
+				node.length = static_cast<uint32_t>(members.size() - frame.start);
+				node.members = copyRange(members.data() + frame.start, node.length);
+				members.resize(frame.start);
+				add(node);
+			}
+
+			void onStartArray() override
+			{
+				frames.push_back(Frame{ false, values.size(), {} });
+			}
+
+			void onEndArray() override
+			{
+				const Frame frame = frames.back();
+				frames.pop_back();
+
+				JsonNode node;
+				node.type = JsonType::Array;
+				node.length = static_cast<uint32_t>(values.size() - frame.start);
+				node.elements = copyRange(values.data() + frame.start, node.length);
+				values.resize(frame.start);
+				add(node);
+			}
+
+			void onString(std::string_view value) override
+			{
+				JsonNode node;
+				node.type = JsonType::String;
+				node.length = static_cast<uint32_t>(value.size());
+				node.string = copyString(value).data();
+				add(node);
+			}
+
+			void onNumber(double value) override
+			{
+				JsonNode node;
+				node.type = JsonType::Double;
+				node.doubleValue = value;
+				add(node);
+			}
+
+			void onInt(int value) override
+			{
+				JsonNode node;
+				node.type = JsonType::Int;
+				node.intValue = value;
+				add(node);
+			}
+
+			void onBoolean(bool value) override
+			{
+				JsonNode node;
+				node.type = JsonType::Boolean;
+				node.boolValue = value;
+				add(node);
+			}
+
+			void onNull() override
+			{
+				add(JsonNode());
+			}
+
+			const JsonNode& getRoot() const
+			{
+				return root;
+			}
+
+		private:
+			/**
+			 * @brief An open container and where its children start on the scratch stack.
+			 */
+			struct Frame
+			{
+				bool isObject;
+				size_t start;
+				std::string_view key;
+			};
+
+			void add(const JsonNode& node)
+			{
+				if (frames.empty())
+				{
+					root = node;
+				}
+				else if (frames.back().isObject)
+				{
+					members.push_back(JsonMember{ frames.back().key, node });
+				}
+				else
+				{
+					values.push_back(node);
+				}
+			}
+
+			std::string_view copyString(std::string_view value)
+			{
+				if (value.empty())
+				{
+					return {};
+				}
+				if (std::less_equal<const char*>()(borrowed.data(), value.data())
+					&& std::less_equal<const char*>()(value.data() + value.size(), borrowed.data() + borrowed.size()))
+				{
+					return value;
+				}
+
+				char* data = static_cast<char*>(arena.allocate(value.size(), 1));
+				std::memcpy(data, value.data(), value.size());
+				return std::string_view(data, value.size());
+			}
+
+			template <typename T>
+			const T* copyRange(const T* first, size_t count)
+			{
+				if (count == 0)
+				{
+					return nullptr;
+				}
+
+				T* data = static_cast<T*>(arena.allocate(count * sizeof(T), alignof(T)));
+				std::uninitialized_copy(first, first + count, data);
+				return data;
+			}
+
+			std::pmr::memory_resource& arena;
+			std::string_view borrowed;
+			std::vector<Frame> frames;
+			std::vector<JsonNode> values;
+			std::vector<JsonMember> members;
+			JsonNode root;
+		};
+
+
+		JsonType JsonNode::getType() const
+		{
+			return type;
+		}
+
+		bool JsonNode::isNull() const
+		{
+			return type == JsonType::Null;
+		}
+
+		bool JsonNode::isString() const
+		{
+			return type == JsonType::String;
+		}
+
+		bool JsonNode::isInt() const
+		{
+			return type == JsonType::Int;
+		}
+
+		bool JsonNode::isDouble() const
+		{
+			return type == JsonType::Double;
+		}
+
+		bool JsonNode::isBoolean() const
+		{
+			return type == JsonType::Boolean;
+		}
+
+		bool JsonNode::isArray() const
+		{
+			return type == JsonType::Array;
+		}
+
+		bool JsonNode::isObject() const
+		{
+			return type == JsonType::Object;
+		}
+
+
+		std::string_view JsonNode::asString() const
+		{
+			if (type == JsonType::String)
+			{
+				return std::string_view(string, length);
+			}
+			throw r_utils::exception::JsonElementException("Json is not a String");
+		}
+
+		int JsonNode::asInt() const
+		{
+			if (type == JsonType::Int)
+			{
+				return intValue;
+			}
+			throw r_utils::exception::JsonElementException("Json is not an Int");
+		}
+
+		double JsonNode::asDouble() const
+		{
+			if (type == JsonType::Double)
+			{
+				return doubleValue;
+			}
+			throw r_utils::exception::JsonElementException("Json is not a Double");
+		}
+
+		bool JsonNode::asBoolean() const
+		{
+			if (type == JsonType::Boolean)
+			{
+				return boolValue;
+			}
+			throw r_utils::exception::JsonElementException("Json is not a Boolean");
+		}
+
+
+		size_t JsonNode::size() const
+		{
+			if (type == JsonType::Array || type == JsonType::Object)
+			{
+				return length;
+			}
+			throw r_utils::exception::JsonElementException("Json is not an Array or Object");
+		}
+
+		std::span<const JsonNode> JsonNode::getElements() const
+		{
+			if (type == JsonType::Array)
+			{
+				return std::span<const JsonNode>(elements, length);
+			}
+			throw r_utils::exception::JsonElementException("Json is not an Array");
+		}
+
+		std::span<const JsonMember> JsonNode::getMembers() const
+		{
+			if (type == JsonType::Object)
+			{
+				return std::span<const JsonMember>(members, length);
+			}
+			throw r_utils::exception::JsonElementException("Json is not an Object");
+		}
+
+		const JsonNode& JsonNode::operator[](size_t index) const
+		{
+			std::span<const JsonNode> values = getElements();
+			if (index >= values.size())
+			{
+				throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+			}
+			return values[index];
+		}
+
+		bool JsonNode::contains(std::string_view key) const
+		{
+			for (const JsonMember& member : getMembers())
+			{
+				if (member.key == key) return true;
+			}
+			return false;
+		}
+
+		const JsonNode& JsonNode::get(std::string_view key) const
+		{
+			for (const JsonMember& member : getMembers())
+			{
+				if (member.key == key) return member.value;
+			}
+			throw r_utils::exception::JsonObjectException("Key not found: " + std::string(key));
+		}
+
+		JsonElement JsonNode::toElement() const
+		{
+			switch (type)
+			{
+				case JsonType::String:
+					return JsonElement(std::string(string, length));
+				case JsonType::Int:
+					return JsonElement(intValue);
+				case JsonType::Double:
+					return JsonElement(doubleValue);
+				case JsonType::Boolean:
+					return JsonElement(boolValue);
+				case JsonType::Array:
+				{
+					JsonArray array;
+					for (const JsonNode& element : getElements())
+					{
+						array.add(element.toElement());
+					}
+					return JsonElement(std::move(array));
+				}
+				case JsonType::Object:
+				{
+					JsonObject object;
+					for (const JsonMember& member : getMembers())
+					{
+						object.set(std::string(member.key), member.value.toElement());
+					}
+					return JsonElement(std::move(object));
+				}
+				default:
+					return JsonElement(nullptr);
+			}
+		}
+
+
+		JsonDocument::JsonDocument(size_t inputSize)
+			: arena(std::make_unique<std::pmr::monotonic_buffer_resource>(std::max<size_t>(inputSize, 4096)))
+		{}
+
+		JsonDocument JsonDocument::parse(std::string_view input)
+		{
+			JsonDocument document(input.size());
+
+			JsonDocumentBuilder builder(*document.arena);
+			JsonParser::parse(input, builder);
+			document.root = builder.getRoot();
+
+			return document;
+		}
+
+		JsonDocument JsonDocument::parse(const r_utils::io::File& file)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			return parse(std::string_view(buffer));
+		}
+
+		JsonDocument JsonDocument::parseMapped(const r_utils::io::File& file)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			r_utils::io::MappedFile mapping(file, r_utils::io::MappedFile::Access::Sequential);
+			const std::string_view input = mapping.getView();
+
+			// Most strings are referenced in place, so the arena mainly holds nodes.
+			JsonDocument document(input.size() / 2);
+			JsonDocumentBuilder builder(*document.arena, input);
+			JsonParser::parse(input, builder);
+			document.root = builder.getRoot();
+			document.mapping.emplace(std::move(mapping));
+
+			return document;
+		}
+
+		const JsonNode& JsonDocument::getRoot() const
+		{
+			return root;
+		}
+	} // json
+} // r_utils
@@ -1,49 +1,202 @@
 #include "json/JsonElement.h"
 #include "json/JsonObject.h"
+#include "json/JsonSerializer.h"
 
 #include "exception/json/JsonElementException.h"
 
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
 namespace r_utils 
 {
     namespace json 
     {
 
+        static_assert(sizeof(JsonElement) <= 16, "JsonElement should stay a tag plus an 8-byte payload");
+
+        template <typename T>
+        struct JsonElement::Shared
+        {
+            template <typename... Args>
+            explicit Shared(Args&&... args)
+                : value(std::forward<Args>(args)...)
+            {}
+
+            std::atomic<size_t> references{ 1 };
+            /** Cached JsonElement::hash of the value, or 0 if it has not been computed. */
+            std::atomic<uint64_t> hash{ 0 };
+            T value;
+        };
+
+        /** @brief Adds a reference to a shared value. */
+        template <typename T>
+        static T* retain(T* shared)
+        {
+            shared->references.fetch_add(1, std::memory_order_relaxed);
+            return shared;
+        }
+
+        /** @brief Drops a reference to a shared value and frees it with the last one. */
+        template <typename T>
+        static void drop(T* shared)
+        {
+            if (shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete shared;
+            }
+        }
+
+        /**
+         * @brief Makes sure the caller holds the only reference before a write.
+         *
+         * A shared value is replaced by a private copy. For containers the copy holds
+         * new references to the same children, so only one level is copied.
+         */
+        template <typename T>
+        static auto& detach(T*& shared)
+        {
+            if (shared->references.load(std::memory_order_acquire) != 1)
+            {
+                T* copy = new T(shared->value);
+                drop(shared);
+                shared = copy;
+            }
+            // The caller may change the value, so its hash has to be recomputed.
+            shared->hash.store(0, std::memory_order_relaxed);
+            return shared->value;
+        }
+
+        static uint64_t mixHash(uint64_t value)
+        {
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            value *= 0xc4ceb9fe1a85ec53ULL;
+            value ^= value >> 33;
+            return value;
+        }
+
+        /** @brief Returns the cached hash of a shared value, computing and storing it on first use. */
+        template <typename T, typename Compute>
+        static uint64_t cachedHash(T* shared, Compute compute)
+        {
+            uint64_t result = shared->hash.load(std::memory_order_relaxed);
+            if (result == 0)
+            {
+                result = compute(shared->value);
+                result = result != 0 ? result : 1;
+                shared->hash.store(result, std::memory_order_relaxed);
+            }
+            return result;
+        }
+
         JsonElement::JsonElement()
-            : type(JsonType::Null), value(std::monostate{}) 
+            : payload{}, type(JsonType::Null) 
         {}
 
         JsonElement::JsonElement(const std::string& value)
-            : type(JsonType::String), value(value) 
+            : payload{ .string = new Shared<std::string>(value) }, type(JsonType::String) 
+        {}
+
+        JsonElement::JsonElement(std::string&& value)
+            : payload{ .string = new Shared<std::string>(std::move(value)) }, type(JsonType::String) 
         {}
 
         JsonElement::JsonElement(const char* value)
-            : type(JsonType::String), value(std::string(value)) 
+            : payload{ .string = new Shared<std::string>(value) }, type(JsonType::String) 
         {}
 
         JsonElement::JsonElement(int value)
-            : type(JsonType::Int), value(value) 
+            : payload{ .intValue = value }, type(JsonType::Int) 
         {}
 
         JsonElement::JsonElement(double value)
-            : type(JsonType::Double), value(value) 
+            : payload{ .doubleValue = value }, type(JsonType::Double) 
         {}
 
         JsonElement::JsonElement(bool value)
-            : type(JsonType::Boolean), value(value) 
+            : payload{ .boolValue = value }, type(JsonType::Boolean) 
         {}
 
-        JsonElement::JsonElement(nullptr_t value)
-            : type(JsonType::Null), value(value) 
+        JsonElement::JsonElement(nullptr_t)
+            : payload{}, type(JsonType::Null) 
         {}
 
         JsonElement::JsonElement(const r_utils::json::JsonArray& value)
-            : type(JsonType::Array), value(value) 
+            : payload{ .array = new Shared<JsonArray>(value) }, type(JsonType::Array) 
+        {}
+
+        JsonElement::JsonElement(r_utils::json::JsonArray&& value)
+            : payload{ .array = new Shared<JsonArray>(std::move(value)) }, type(JsonType::Array) 
         {}
 
         JsonElement::JsonElement(const r_utils::json::JsonObject& value)
-            : type(JsonType::Object), value(value) 
+            : payload{ .object = new Shared<JsonObject>(value) }, type(JsonType::Object) 
+        {}
+
+        JsonElement::JsonElement(r_utils::json::JsonObject&& value)
+            : payload{ .object = new Shared<JsonObject>(std::move(value)) }, type(JsonType::Object) 
         {}
 
+        JsonElement::JsonElement(const JsonElement& other)
+            : payload(other.payload), type(other.type)
+        {
+            switch (type)
+            {
+                case JsonType::String: retain(payload.string); break;
+                case JsonType::Array: retain(payload.array); break;
+                case JsonType::Object: retain(payload.object); break;
+                default: break;
+            }
+        }
+
+        JsonElement::JsonElement(JsonElement&& other) noexcept
+            : payload(other.payload), type(other.type)
+        {
+            other.type = JsonType::Null;
+        }
+
+        JsonElement& JsonElement::operator=(const JsonElement& other)
+        {
+            if (this != &other)
+            {
+                JsonElement copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        JsonElement& JsonElement::operator=(JsonElement&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                payload = other.payload;
+                type = other.type;
+                other.type = JsonType::Null;
+            }
+            return *this;
+        }
+
+        JsonElement::~JsonElement()
+        {
+            release();
+        }
+
+        void JsonElement::release()
+        {
+            switch (type)
+            {
+                case JsonType::String: drop(payload.string); break;
+                case JsonType::Array: drop(payload.array); break;
+                case JsonType::Object: drop(payload.object); break;
+                default: break;
+            }
+            type = JsonType::Null;
+        }
+
 
         JsonType JsonElement::getType() const 
         {
@@ -52,32 +205,83 @@ namespace r_utils
 
         std::string JsonElement::stringify() const 
         {
-            switch (type) 
+            return JsonSerializer::serialize(*this);
+        }
+
+        JsonElement::Value JsonElement::getValue() const
+        {
+            switch (type)
+            {
+                case JsonType::String: return payload.string->value;
+                case JsonType::Int: return payload.intValue;
+                case JsonType::Double: return payload.doubleValue;
+                case JsonType::Boolean: return payload.boolValue;
+                case JsonType::Array: return payload.array->value;
+                case JsonType::Object: return payload.object->value;
+                default: return nullptr;
+            }
+        }
+
+        bool JsonElement::sharesWith(const JsonElement& other) const
+        {
+            if (type != other.type)
+            {
+                return false;
+            }
+
+            switch (type)
+            {
+                case JsonType::String: return payload.string == other.payload.string;
+                case JsonType::Array: return payload.array == other.payload.array;
+                case JsonType::Object: return payload.object == other.payload.object;
+                default: return false;
+            }
+        }
+
+        uint64_t JsonElement::hash() const
+        {
+            switch (type)
             {
-                case JsonType::Null:
-                    return "null";
                 case JsonType::String:
-                    return "\"" + std::get<std::string>(value) + "\"";
+                    return cachedHash(payload.string, [](const std::string& value) {
+                        return mixHash(std::hash<std::string_view>()(value) + 1);
+                    });
                 case JsonType::Int:
-                    return std::to_string(std::get<int>(value));
+                    return mixHash(static_cast<uint64_t>(static_cast<int64_t>(payload.intValue)) + 2);
                 case JsonType::Double:
-                    return std::to_string(std::get<double>(value));
+                {
+                    // 0.0 and -0.0 compare equal, so they must hash alike.
+                    const double value = payload.doubleValue == 0.0 ? 0.0 : payload.doubleValue;
+                    uint64_t bits;
+                    std::memcpy(&bits, &value, sizeof(bits));
+                    return mixHash(bits + 3);
+                }
                 case JsonType::Boolean:
-                    return std::get<bool>(value) ? "true" : "false";
+                    return mixHash(payload.boolValue ? 4 : 5);
                 case JsonType::Array:
-                    return std::get<JsonArray>(value).toString();
+                    return cachedHash(payload.array, [](const JsonArray& value) {
+                        uint64_t result = mixHash(7);
+                        for (const JsonElement& child : value.getValues())
+                        {
+                            result = mixHash(result ^ child.hash());
+                        }
+                        return result;
+                    });
                 case JsonType::Object:
-                    return std::get<JsonObject>(value).toString();
+                    return cachedHash(payload.object, [](const JsonObject& value) {
+                        // Members are summed so that their order does not matter.
+                        uint64_t result = mixHash(8);
+                        for (const auto& [key, child] : value)
+                        {
+                            result += mixHash(std::hash<std::string_view>()(key) + mixHash(child.hash()));
+                        }
+                        return mixHash(result);
+                    });
                 default:
-                    return "null";
+                    return mixHash(6);
             }
         }
 
-        std::variant <std::monostate, std::string, int, double, bool, nullptr_t, r_utils::json::JsonObject, r_utils::json::JsonArray> JsonElement::getValue() const
-        {
-            return this->value;
-        }
-
         bool JsonElement::isNull() const 
         {
             return type == JsonType::Null;
@@ -115,11 +319,20 @@ namespace r_utils
         }
 
 
-        std::string JsonElement::asString() const 
+        const std::string& JsonElement::asString() const 
+        {
+            if (type == JsonType::String) 
+            {
+                return payload.string->value;
+            }
+            throw r_utils::exception::JsonElementException("Json is not a String");
+        }
+
+        std::string& JsonElement::asString()
         {
             if (type == JsonType::String) 
             {
-                return std::get<std::string>(value);
+                return detach(payload.string);
             }
             throw r_utils::exception::JsonElementException("Json is not a String");
         }
@@ -129,7 +342,7 @@ namespace r_utils
         {
             if (type == JsonType::Int) 
             {
-                return std::get<int>(value);
+                return payload.intValue;
             }
             throw r_utils::exception::JsonElementException("Json is not an Int");
         }
@@ -138,7 +351,7 @@ namespace r_utils
         {
             if (type == JsonType::Double) 
             {
-                return std::get<double>(value);
+                return payload.doubleValue;
             }
             throw r_utils::exception::JsonElementException("Json is not a Double");
         }
@@ -147,25 +360,43 @@ namespace r_utils
         {
             if (type == JsonType::Boolean) 
             {
-                return std::get<bool>(value);
+                return payload.boolValue;
             }
             throw r_utils::exception::JsonElementException("Json is not a Boolean");
         }
 
-        r_utils::json::JsonArray JsonElement::asArray() const
+        const r_utils::json::JsonArray& JsonElement::asArray() const
+        {
+            if (type == JsonType::Array) 
+            {
+                return payload.array->value;
+            }
+            throw r_utils::exception::JsonElementException("Json is not an Array");
+        }
+
+        r_utils::json::JsonArray& JsonElement::asArray()
         {
             if (type == JsonType::Array) 
             {
-                return std::get<JsonArray>(value);
+                return detach(payload.array);
             }
             throw r_utils::exception::JsonElementException("Json is not an Array");
         }
 
-        r_utils::json::JsonObject JsonElement::asObject() const 
+        const r_utils::json::JsonObject& JsonElement::asObject() const 
         {
             if (type == JsonType::Object) 
             {
-                return std::get<JsonObject>(value);
+                return payload.object->value;
+            }
+            throw r_utils::exception::JsonElementException("Json is not an Object");
+        }
+
+        r_utils::json::JsonObject& JsonElement::asObject()
+        {
+            if (type == JsonType::Object) 
+            {
+                return detach(payload.object);
             }
             throw r_utils::exception::JsonElementException("Json is not an Object");
         }
@@ -190,7 +421,27 @@ namespace r_utils
 
         bool operator==(const r_utils::json::JsonElement& x, const r_utils::json::JsonElement& y)
         {
-            return (x.getType() == y.getType()) && (x.getValue() == y.getValue());
+            if (x.getType() != y.getType())
+            {
+                return false;
+            }
+            if (x.sharesWith(y))
+            {
+                return true;
+            }
+
+            switch (x.getType())
+            {
+                case JsonType::String: return x.asString() == y.asString();
+                case JsonType::Int: return x.asInt() == y.asInt();
+                case JsonType::Double: return x.asDouble() == y.asDouble();
+                case JsonType::Boolean: return x.asBoolean() == y.asBoolean();
+                // Not short-circuited on hash(): a write through a reference held across
+                // the hash computation leaves the cached value stale.
+                case JsonType::Array: return x.asArray() == y.asArray();
+                case JsonType::Object: return x.asObject() == y.asObject();
+                default: return true;
+            }
         }
 
         bool operator!=(const r_utils::json::JsonElement& x, const r_utils::json::JsonElement& y)
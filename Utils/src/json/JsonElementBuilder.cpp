@@ -0,0 +1,103 @@
+#include "json/JsonElementBuilder.h"
+
+#include "exception/json/JsonParserException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+
+		JsonElementBuilder::JsonElementBuilder(JsonKeyPool& keyPool)
+			: keyPool(&keyPool)
+		{}
+
+		void JsonElementBuilder::onStartObject()
+		{
+			stack.push_back(Frame{ true, {}, {}, {} });
+		}
+
+		void JsonElementBuilder::onKey(std::string_view key)
+		{
+			stack.back().key = keyPool ? keyPool->intern(key) : JsonKey(key);
+		}
+
+		void JsonElementBuilder::onEndObject()
+		{
+			JsonObject object = std::move(stack.back().object);
+			stack.pop_back();
+			addValue(JsonElement(std::move(object)));
+		}
+
+		void JsonElementBuilder::onStartArray()
+		{
+			stack.push_back(Frame{ false, {}, {}, {} });
+		}
+
+		void JsonElementBuilder::onEndArray()
+		{
+			JsonArray array = std::move(stack.back().array);
+			stack.pop_back();
+			addValue(JsonElement(std::move(array)));
+		}
+
+		void JsonElementBuilder::onString(std::string_view value)
+		{
+			addValue(JsonElement(std::string(value)));
+		}
+
+		void JsonElementBuilder::onNumber(double value)
+		{
+			addValue(JsonElement(value));
+		}
+
+		void JsonElementBuilder::onInt(int value)
+		{
+			addValue(JsonElement(value));
+		}
+
+		void JsonElementBuilder::onBoolean(bool value)
+		{
+			addValue(JsonElement(value));
+		}
+
+		void JsonElementBuilder::onNull()
+		{
+			addValue(JsonElement(nullptr));
+		}
+
+
+		bool JsonElementBuilder::hasResult() const
+		{
+			return ready;
+		}
+
+		JsonElement JsonElementBuilder::takeResult()
+		{
+			if (!ready)
+			{
+				throw r_utils::exception::JsonParserException("No complete JSON value has been built");
+			}
+
+			ready = false;
+			return std::move(result);
+		}
+
+
+		void JsonElementBuilder::addValue(JsonElement&& value)
+		{
+			if (stack.empty())
+			{
+				result = std::move(value);
+				ready = true;
+			}
+			else if (stack.back().isObject)
+			{
+				stack.back().object.set(stack.back().key, std::move(value));
+			}
+			else
+			{
+				stack.back().array.add(std::move(value));
+			}
+		}
+	} // json
+} // r_utils
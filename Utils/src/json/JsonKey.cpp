@@ -0,0 +1,67 @@
+#include "json/JsonKey.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		JsonKey::JsonKey() = default;
+
+		JsonKey::JsonKey(std::string value)
+			: value(std::move(value)) {}
+
+		JsonKey::JsonKey(std::string_view value)
+			: value(std::string(value)) {}
+
+		JsonKey::JsonKey(const char* value)
+			: value(std::string(value)) {}
+
+		JsonKey::JsonKey(std::shared_ptr<const std::string> value)
+		{
+			if (value)
+			{
+				this->value = std::move(value);
+			}
+		}
+
+
+		const std::string& JsonKey::str() const
+		{
+			const std::shared_ptr<const std::string>* shared = std::get_if<std::shared_ptr<const std::string>>(&value);
+			return shared ? **shared : std::get<std::string>(value);
+		}
+
+		bool JsonKey::empty() const
+		{
+			return str().empty();
+		}
+
+		size_t JsonKey::size() const
+		{
+			return str().size();
+		}
+
+		JsonKey::operator const std::string&() const
+		{
+			return str();
+		}
+
+		JsonKey::operator std::string_view() const
+		{
+			return str();
+		}
+
+		bool JsonKey::sameAs(const JsonKey& other) const
+		{
+			const std::shared_ptr<const std::string>* shared = std::get_if<std::shared_ptr<const std::string>>(&value);
+			const std::shared_ptr<const std::string>* otherShared = std::get_if<std::shared_ptr<const std::string>>(&other.value);
+			return shared && otherShared && *shared == *otherShared;
+		}
+
+
+		std::ostream& operator<<(std::ostream& os, const JsonKey& key)
+		{
+			os << key.str();
+			return os;
+		}
+	} // json
+} // r_utils
@@ -0,0 +1,42 @@
+#include "json/JsonKeyPool.h"
+
+#include <mutex>
+
+namespace r_utils
+{
+	namespace json
+	{
+		JsonKey JsonKeyPool::intern(std::string_view key)
+		{
+			{
+				std::shared_lock lock(mutex);
+				auto it = keys.find(key);
+				if (it != keys.end())
+				{
+					return JsonKey(it->second);
+				}
+			}
+
+			std::unique_lock lock(mutex);
+			auto it = keys.find(key);
+			if (it == keys.end())
+			{
+				auto value = std::make_shared<const std::string>(key);
+				it = keys.emplace(std::string_view(*value), value).first;
+			}
+			return JsonKey(it->second);
+		}
+
+		size_t JsonKeyPool::size() const
+		{
+			std::shared_lock lock(mutex);
+			return keys.size();
+		}
+
+		void JsonKeyPool::clear()
+		{
+			std::unique_lock lock(mutex);
+			keys.clear();
+		}
+	} // json
+} // r_utils
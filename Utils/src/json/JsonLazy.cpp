@@ -0,0 +1,460 @@
+#include "json/JsonLazy.h"
+#include "json/JsonParser.h"
+#include "json/JsonStructuralIndex.h"
+
+#include "exception/json/JsonArrayException.h"
+#include "exception/json/JsonElementException.h"
+#include "exception/json/JsonObjectException.h"
+#include "exception/json/JsonParserException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonLazyStructure
+		 * @brief The structural index of a lazy document plus the matching bracket of every container.
+		 *
+		 * Tokens are indices into the structural index. For every opening bracket,
+		 * matches holds the token of its closing bracket.
+		 */
+		class JsonLazyStructure
+		{
+		public:
+			static constexpr size_t npos = static_cast<size_t>(-1);
+
+			explicit JsonLazyStructure(std::string_view input)
+				: input(input), index(input)
+			{
+				matchBrackets();
+			}
+
+			explicit JsonLazyStructure(std::string contents)
+				: buffer(std::move(contents)), input(buffer), index(input)
+			{
+				matchBrackets();
+			}
+
+			JsonLazyStructure(const JsonLazyStructure&) = delete;
+			JsonLazyStructure& operator=(const JsonLazyStructure&) = delete;
+
+			char at(size_t token) const
+			{
+				return token < index.size() ? input[index[token]] : '\0';
+			}
+
+			bool isContainer(size_t token) const
+			{
+				const char c = at(token);
+				return c == '{' || c == '[';
+			}
+
+			/** Returns the token following the value at the given token. */
+			size_t skip(size_t token) const
+			{
+				return isContainer(token) ? matches[token] + 1 : token + 1;
+			}
+
+			/** Returns the first element or key of a container, or npos if it is empty. */
+			size_t first(size_t open) const
+			{
+				return matches[open] == open + 1 ? npos : open + 1;
+			}
+
+			/** Returns the element or key following the value at the given token, or npos at the end of the container. */
+			size_t next(size_t value, char close) const
+			{
+				const size_t after = skip(value);
+				const char c = at(after);
+				if (c == close)
+				{
+					return npos;
+				}
+				if (c != ',')
+				{
+					if (close == ']')
+						throw r_utils::exception::JsonParserException("Expected ',' or ']' in array, got '" + std::string(1, c) + "'");
+					throw r_utils::exception::JsonParserException("Expected ',' or '}' in object");
+				}
+				if (at(after + 1) == close)
+				{
+					throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, close));
+				}
+				return after + 1;
+			}
+
+			/** Returns the raw key at the given token and checks the ':' that follows it. Sets escaped if the key has escapes. */
+			std::string_view key(size_t token, bool& escaped) const
+			{
+				const char quote = at(token);
+				if (quote != '"' && quote != '\'')
+				{
+					throw r_utils::exception::JsonParserException("Expected string, got '" + std::string(1, quote) + "'");
+				}
+				if (at(token + 1) != ':')
+				{
+					throw r_utils::exception::JsonParserException("Expected ':' after key");
+				}
+
+				const size_t begin = index[token] + 1;
+				size_t end = index[token + 1];
+				while (end > begin && isWhitespace(input[end - 1])) end--;
+				if (end == begin || input[end - 1] != quote)
+				{
+					throw r_utils::exception::JsonParserException("Unterminated string");
+				}
+
+				std::string_view raw = input.substr(begin, end - 1 - begin);
+				escaped = raw.find('\\') != std::string_view::npos;
+				return raw;
+			}
+
+			/** Returns the key at the given token with all escapes resolved. */
+			std::string unescapedKey(size_t token) const
+			{
+				bool escaped = false;
+				std::string_view raw = key(token, escaped);
+				if (!escaped)
+				{
+					return std::string(raw);
+				}
+				return JsonParser::parse(input.substr(index[token], raw.size() + 2)).asString();
+			}
+
+			std::string_view raw(size_t token) const
+			{
+				const size_t begin = index[token];
+				if (isContainer(token))
+				{
+					return input.substr(begin, index[matches[token]] + 1 - begin);
+				}
+
+				size_t end = token + 1 < index.size() ? index[token + 1] : input.size();
+				while (end > begin && isWhitespace(input[end - 1])) end--;
+				return input.substr(begin, end - begin);
+			}
+
+		private:
+			static bool isWhitespace(char c)
+			{
+				return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+			}
+
+			void matchBrackets()
+			{
+				if (index.empty())
+				{
+					throw r_utils::exception::JsonParserException("Unexpected end of input");
+				}
+
+				matches.resize(index.size());
+				std::vector<uint32_t> open;
+
+				for (size_t i = 0; i < index.size(); ++i)
+				{
+					const char c = input[index[i]];
+					if (c == '{' || c == '[')
+					{
+						open.push_back(static_cast<uint32_t>(i));
+					}
+					else if (c == '}' || c == ']')
+					{
+						if (open.empty() || input[index[open.back()]] != (c == '}' ? '{' : '['))
+						{
+							throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+						}
+						matches[open.back()] = static_cast<uint32_t>(i);
+						open.pop_back();
+					}
+				}
+
+				if (!open.empty())
+				{
+					throw r_utils::exception::JsonParserException("Unexpected end of input");
+				}
+
+				// Like the eager parser, accept nothing but whitespace after the root value.
+				const size_t end = skip(0);
+				if (end != index.size())
+				{
+					throw r_utils::exception::JsonParserException("Unexpected character after value: " + std::string(1, at(end)));
+				}
+			}
+
+		public:
+			std::string buffer;
+			std::string_view input;
+			JsonStructuralIndex index;
+			std::vector<uint32_t> matches;
+		};
+
+
+		JsonLazyValue::JsonLazyValue(const JsonLazyStructure* structure, size_t token)
+			: structure(structure), token(token) {}
+
+		JsonType JsonLazyValue::getType() const
+		{
+			switch (structure->at(token))
+			{
+				case '{': return JsonType::Object;
+				case '[': return JsonType::Array;
+				case '"': case '\'': return JsonType::String;
+				case 'n': return JsonType::Null;
+				case 't': case 'f': return JsonType::Boolean;
+				default: return toElement().getType();
+			}
+		}
+
+		bool JsonLazyValue::isNull() const { return getType() == JsonType::Null; }
+		bool JsonLazyValue::isString() const { return getType() == JsonType::String; }
+		bool JsonLazyValue::isInt() const { return getType() == JsonType::Int; }
+		bool JsonLazyValue::isDouble() const { return getType() == JsonType::Double; }
+		bool JsonLazyValue::isBoolean() const { return getType() == JsonType::Boolean; }
+		bool JsonLazyValue::isArray() const { return structure->at(token) == '['; }
+		bool JsonLazyValue::isObject() const { return structure->at(token) == '{'; }
+
+		std::string JsonLazyValue::asString() const
+		{
+			if (!isString())
+			{
+				throw r_utils::exception::JsonElementException("Json is not a String");
+			}
+			return toElement().asString();
+		}
+
+		int JsonLazyValue::asInt() const
+		{
+			return toElement().asInt();
+		}
+
+		double JsonLazyValue::asDouble() const
+		{
+			return toElement().asDouble();
+		}
+
+		bool JsonLazyValue::asBoolean() const
+		{
+			if (!isBoolean())
+			{
+				throw r_utils::exception::JsonElementException("Json is not a Boolean");
+			}
+			return toElement().asBoolean();
+		}
+
+		JsonLazyArray JsonLazyValue::asArray() const
+		{
+			if (!isArray())
+			{
+				throw r_utils::exception::JsonElementException("Json is not an Array");
+			}
+			return JsonLazyArray(structure, token);
+		}
+
+		JsonLazyObject JsonLazyValue::asObject() const
+		{
+			if (!isObject())
+			{
+				throw r_utils::exception::JsonElementException("Json is not an Object");
+			}
+			return JsonLazyObject(structure, token);
+		}
+
+		JsonElement JsonLazyValue::toElement() const
+		{
+			return JsonParser::parse(getRaw());
+		}
+
+		std::string_view JsonLazyValue::getRaw() const
+		{
+			return structure->raw(token);
+		}
+
+
+		JsonLazyArray::Iterator::Iterator(const JsonLazyStructure* structure, size_t token)
+			: structure(structure), token(token) {}
+
+		JsonLazyValue JsonLazyArray::Iterator::operator*() const
+		{
+			return JsonLazyValue(structure, token);
+		}
+
+		JsonLazyArray::Iterator& JsonLazyArray::Iterator::operator++()
+		{
+			token = structure->next(token, ']');
+			return *this;
+		}
+
+		JsonLazyArray::Iterator JsonLazyArray::Iterator::operator++(int)
+		{
+			Iterator copy = *this;
+			++*this;
+			return copy;
+		}
+
+		bool JsonLazyArray::Iterator::operator==(const Iterator& other) const
+		{
+			return token == other.token;
+		}
+
+		bool JsonLazyArray::Iterator::operator!=(const Iterator& other) const
+		{
+			return token != other.token;
+		}
+
+
+		JsonLazyArray::JsonLazyArray(const JsonLazyStructure* structure, size_t token)
+			: structure(structure), token(token) {}
+
+		size_t JsonLazyArray::size() const
+		{
+			size_t count = 0;
+			for (auto it = begin(); it != end(); ++it)
+			{
+				count++;
+			}
+			return count;
+		}
+
+		bool JsonLazyArray::empty() const
+		{
+			return structure->first(token) == JsonLazyStructure::npos;
+		}
+
+		JsonLazyValue JsonLazyArray::get(size_t index) const
+		{
+			size_t i = 0;
+			for (auto it = begin(); it != end(); ++it, ++i)
+			{
+				if (i == index)
+				{
+					return *it;
+				}
+			}
+			throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+		}
+
+		JsonLazyValue JsonLazyArray::operator[](size_t index) const
+		{
+			return get(index);
+		}
+
+		JsonLazyArray::Iterator JsonLazyArray::begin() const
+		{
+			return Iterator(structure, structure->first(token));
+		}
+
+		JsonLazyArray::Iterator JsonLazyArray::end() const
+		{
+			return Iterator(structure, JsonLazyStructure::npos);
+		}
+
+
+		JsonLazyObject::JsonLazyObject(const JsonLazyStructure* structure, size_t token)
+			: structure(structure), token(token) {}
+
+		size_t JsonLazyObject::size() const
+		{
+			size_t count = 0;
+			for (size_t key = structure->first(token); key != JsonLazyStructure::npos; key = structure->next(key + 2, '}'))
+			{
+				bool escaped;
+				structure->key(key, escaped);
+				count++;
+			}
+			return count;
+		}
+
+		bool JsonLazyObject::empty() const
+		{
+			return structure->first(token) == JsonLazyStructure::npos;
+		}
+
+		bool JsonLazyObject::contains(std::string_view key) const
+		{
+			size_t valueToken;
+			return find(key, valueToken);
+		}
+
+		JsonLazyValue JsonLazyObject::get(std::string_view key) const
+		{
+			size_t valueToken;
+			if (!find(key, valueToken))
+			{
+				throw r_utils::exception::JsonObjectException("Key not found: " + std::string(key));
+			}
+			return JsonLazyValue(structure, valueToken);
+		}
+
+		JsonLazyValue JsonLazyObject::operator[](std::string_view key) const
+		{
+			return get(key);
+		}
+
+		std::vector<std::string> JsonLazyObject::getKeys() const
+		{
+			std::vector<std::string> keys;
+			for (size_t key = structure->first(token); key != JsonLazyStructure::npos; key = structure->next(key + 2, '}'))
+			{
+				keys.push_back(structure->unescapedKey(key));
+			}
+			return keys;
+		}
+
+		bool JsonLazyObject::find(std::string_view key, size_t& valueToken) const
+		{
+			for (size_t member = structure->first(token); member != JsonLazyStructure::npos; member = structure->next(member + 2, '}'))
+			{
+				bool escaped;
+				std::string_view raw = structure->key(member, escaped);
+				if (escaped ? structure->unescapedKey(member) == key : raw == key)
+				{
+					valueToken = member + 2;
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+		JsonLazyDocument::JsonLazyDocument(std::string_view input)
+			: structure(std::make_unique<JsonLazyStructure>(input)) {}
+
+		JsonLazyDocument::JsonLazyDocument(const r_utils::io::File& file)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+			structure = std::make_unique<JsonLazyStructure>(file.read());
+		}
+
+		JsonLazyDocument::~JsonLazyDocument() = default;
+		JsonLazyDocument::JsonLazyDocument(JsonLazyDocument&& other) noexcept = default;
+		JsonLazyDocument& JsonLazyDocument::operator=(JsonLazyDocument&& other) noexcept = default;
+
+		JsonLazyValue JsonLazyDocument::getRoot() const
+		{
+			return JsonLazyValue(structure.get(), 0);
+		}
+
+		bool JsonLazyDocument::isObject() const
+		{
+			return getRoot().isObject();
+		}
+
+		bool JsonLazyDocument::isArray() const
+		{
+			return getRoot().isArray();
+		}
+
+		JsonLazyObject JsonLazyDocument::asObject() const
+		{
+			return getRoot().asObject();
+		}
+
+		JsonLazyArray JsonLazyDocument::asArray() const
+		{
+			return getRoot().asArray();
+		}
+	} // json
+} // r_utils
@@ -0,0 +1,203 @@
+#include "json/JsonLinesReader.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace r_utils
+{
+	namespace json
+	{
+
+		/**
+		 * @brief The parsed lines of one batch, or the error that stopped it.
+		 */
+		struct LineBatch
+		{
+			std::vector<JsonElement> elements;
+			std::exception_ptr error;
+			bool done = false;
+		};
+
+		static void parseLines(std::string_view input, size_t begin, size_t end, JsonKeyPool* keyPool, std::vector<JsonElement>& elements)
+		{
+			while (begin < end)
+			{
+				size_t lineEnd = input.find('\n', begin);
+				if (lineEnd == std::string_view::npos || lineEnd > end)
+				{
+					lineEnd = end;
+				}
+
+				std::string_view line = input.substr(begin, lineEnd - begin);
+				if (line.find_first_not_of(" \t\r") != std::string_view::npos)
+				{
+					try
+					{
+						// parse() rejects anything after the value, so a second record on the line is an error.
+						elements.push_back(keyPool ? JsonParser::parse(line, *keyPool) : JsonParser::parse(line));
+					}
+					catch (const r_utils::exception::JsonParserException& error)
+					{
+						constexpr std::string_view TYPE_PREFIX = "[JsonParserException] ";
+						std::string_view message = error.what();
+						if (message.starts_with(TYPE_PREFIX)) message.remove_prefix(TYPE_PREFIX.size());
+
+						const size_t lineNumber = std::count(input.begin(), input.begin() + begin, '\n') + 1;
+						throw r_utils::exception::JsonParserException("Line " + std::to_string(lineNumber) + ": " + std::string(message));
+					}
+				}
+
+				begin = lineEnd + 1;
+			}
+		}
+
+
+		JsonLinesReader::JsonLinesReader(unsigned int threadCount, JsonKeyPool* keyPool)
+			: threadCount(threadCount != 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency())), keyPool(keyPool)
+		{}
+
+		std::vector<JsonElement> JsonLinesReader::read(std::string_view input) const
+		{
+			std::vector<JsonElement> result;
+			read(input, [&result](JsonElement element) {
+				result.push_back(std::move(element));
+			});
+			return result;
+		}
+
+		std::vector<JsonElement> JsonLinesReader::read(const r_utils::io::File& file) const
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			return read(std::string_view(buffer));
+		}
+
+		void JsonLinesReader::read(const r_utils::io::File& file, const std::function<void(JsonElement)>& callback) const
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			read(std::string_view(buffer), callback);
+		}
+
+		void JsonLinesReader::read(std::string_view input, const std::function<void(JsonElement)>& callback) const
+		{
+			std::vector<size_t> bounds{ 0 };
+			while (bounds.back() < input.size())
+			{
+				size_t cut = bounds.back() + BATCH_SIZE;
+				if (cut >= input.size())
+				{
+					cut = input.size();
+				}
+				else
+				{
+					size_t lineEnd = input.find('\n', cut);
+					cut = lineEnd == std::string_view::npos ? input.size() : lineEnd + 1;
+				}
+				bounds.push_back(cut);
+			}
+
+			const size_t batchCount = bounds.size() - 1;
+			const size_t maxInFlight = static_cast<size_t>(threadCount) * BATCHES_AHEAD;
+
+			std::vector<LineBatch> batches(batchCount);
+			std::mutex mutex;
+			std::condition_variable changed;
+			size_t nextBatch = 0;
+			size_t delivered = 0;
+			bool stop = false;
+
+			auto work = [&]() {
+				while (true)
+				{
+					size_t batch;
+					{
+						std::unique_lock<std::mutex> lock(mutex);
+						changed.wait(lock, [&] { return stop || nextBatch >= batchCount || nextBatch < delivered + maxInFlight; });
+						if (stop || nextBatch >= batchCount)
+						{
+							return;
+						}
+						batch = nextBatch++;
+					}
+
+					LineBatch result;
+					try
+					{
+						parseLines(input, bounds[batch], bounds[batch + 1], keyPool, result.elements);
+					}
+					catch (...)
+					{
+						result.error = std::current_exception();
+					}
+					result.done = true;
+
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						batches[batch] = std::move(result);
+					}
+					changed.notify_all();
+				}
+			};
+
+			std::vector<std::jthread> workers;
+			workers.reserve(threadCount);
+			for (unsigned int i = 0; i < threadCount && i < batchCount; ++i)
+			{
+				workers.emplace_back(work);
+			}
+
+			try
+			{
+				for (size_t batch = 0; batch < batchCount; ++batch)
+				{
+					std::vector<JsonElement> elements;
+					{
+						std::unique_lock<std::mutex> lock(mutex);
+						changed.wait(lock, [&] { return batches[batch].done; });
+						if (batches[batch].error)
+						{
+							std::rethrow_exception(batches[batch].error);
+						}
+						elements = std::move(batches[batch].elements);
+						delivered = batch + 1;
+					}
+					changed.notify_all();
+
+					for (JsonElement& element : elements)
+					{
+						callback(std::move(element));
+					}
+				}
+			}
+			catch (...)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stop = true;
+				}
+				changed.notify_all();
+				throw;
+			}
+		}
+
+		unsigned int JsonLinesReader::getThreadCount() const
+		{
+			return threadCount;
+		}
+	} // json
+} // r_utils
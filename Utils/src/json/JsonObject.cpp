@@ -1,58 +1,128 @@
 #include "json/JsonObject.h"
 #include "json/JsonElement.h"
 #include "json/Json.h"
+#include "json/JsonSerializer.h"
 
 #include "exception/json/JsonObjectException.h"
 
+#include <bit>
+#include <functional>
+
 namespace r_utils 
 {
     namespace json 
     {
 
-        bool JsonObject::contains(const std::string& key) const 
+        static size_t hashKey(std::string_view key)
+        {
+            return std::hash<std::string_view>{}(key);
+        }
+
+        bool JsonObject::contains(std::string_view key) const 
+        {
+            return find(key) != values.size();
+        }
+
+        const r_utils::json::JsonElement& JsonObject::get(std::string_view key) const 
         {
-            return values.find(key) != values.end();
+            size_t position = find(key);
+            if (position != values.size()) 
+            {
+                return values[position].second;
+            }
+
+            throw r_utils::exception::JsonObjectException("Key not found: " + std::string(key));
         }
 
-        r_utils::json::JsonElement JsonObject::get(const std::string& key) const 
+        r_utils::json::JsonElement& JsonObject::get(std::string_view key)
         {
-            auto it = values.find(key);
-            if (it != values.end()) 
+            size_t position = find(key);
+            if (position != values.size()) 
             {
-                return it->second;
+                return values[position].second;
             }
 
-            throw r_utils::exception::JsonObjectException("Key not found: " + key);;
+            throw r_utils::exception::JsonObjectException("Key not found: " + std::string(key));
+        }
+
+        const r_utils::json::JsonElement* JsonObject::tryGet(std::string_view key) const
+        {
+            size_t position = find(key);
+            return position != values.size() ? &values[position].second : nullptr;
+        }
+
+        r_utils::json::JsonElement* JsonObject::tryGet(std::string_view key)
+        {
+            size_t position = find(key);
+            return position != values.size() ? &values[position].second : nullptr;
+        }
+
+        const r_utils::json::JsonElement& JsonObject::get(const int index) const
+        {
+            if (index < 0 || index >= static_cast<int>(this->size()))
+            {
+                throw r_utils::exception::JsonObjectException(std::out_of_range("Index out of bounds"));
+            }
+            return values[index].second;
         }
 
-        r_utils::json::JsonElement JsonObject::get(const int index) const
+        r_utils::json::JsonElement& JsonObject::get(const int index)
         {
-            if (index >= this->size()) 
+            if (index < 0 || index >= static_cast<int>(this->size()))
             {
                 throw r_utils::exception::JsonObjectException(std::out_of_range("Index out of bounds"));
             }
-            auto it = values.begin();
-            std::advance(it, index);
-            return it->second;
+            return values[index].second;
+        }
+
+        r_utils::json::JsonObject& JsonObject::set(const JsonKey& key, const JsonElement& value) 
+        {
+            return set(key, JsonElement(value));
         }
 
-        r_utils::json::JsonObject& JsonObject::set(const std::string& key, const JsonElement& value) 
+        r_utils::json::JsonObject& JsonObject::set(const JsonKey& key, JsonElement&& value) 
         {
             if (key.empty())
             {
                 throw r_utils::exception::JsonObjectException("Key value cannot be empty!");
             }
 
-            values[key] = value;
+            size_t position = findKey(key);
+            if (position != values.size())
+            {
+                values[position].second = std::move(value);
+                return *this;
+            }
+
+            values.emplace_back(key, std::move(value));
+            if (values.size() > INDEX_THRESHOLD)
+            {
+                // Keep the table at most half full; growing doubles it.
+                if (index.size() < values.size() * 2)
+                {
+                    rebuildIndex();
+                }
+                else
+                {
+                    indexMember(values.size() - 1);
+                }
+            }
             return *this;
         }
 
-        void JsonObject::remove(const std::string& key)
+        void JsonObject::remove(std::string_view key)
         {
-            values.erase(key);
+            size_t position = find(key);
+            if (position == values.size())
+            {
+                return;
+            }
+
+            values.erase(values.begin() + position);
+            rebuildIndex();
         }
 
-        const std::unordered_map<std::string, r_utils::json::JsonElement>& JsonObject::getValues() const
+        const std::vector<JsonObject::Member>& JsonObject::getValues() const
         {
             return values;
         }
@@ -63,80 +133,86 @@ namespace r_utils
             return values.size();
         }
 
-        std::string JsonObject::indent(int level)
+        bool JsonObject::empty() const
         {
-            return std::string(level, '\t');
+            return values.empty();
         }
 
+        std::vector<JsonObject::Member>::const_iterator JsonObject::begin() const
+        {
+            return values.begin();
+        }
 
-        std::string JsonObject::toString(bool prettyPrint, int indentLevel) const
+        std::vector<JsonObject::Member>::const_iterator JsonObject::end() const
         {
-            std::stringstream result;
+            return values.end();
+        }
 
-            result << "{";
-            if (prettyPrint && !values.empty())
-            {
-                result << "\n";
-            }
 
-            size_t counter = 0;
-            for (const auto [key, value] : values)
+        size_t JsonObject::find(std::string_view key) const
+        {
+            if (index.empty())
             {
-                if (prettyPrint)
-                {
-                    result << indent(indentLevel + 1);
-                }
-
-                result << "\"" << key << "\":";
-                if (prettyPrint)
-                {
-                    result << " ";
-                }
-
-                auto it = value.getType();
-
-                switch (it)
+                for (size_t i = 0; i < values.size(); ++i)
                 {
-                    case r_utils::json::JsonType::Null:
-                        result << "null"; break;
-                    case r_utils::json::JsonType::String:
-                        result << "\"" << value.asString() << "\""; break;
-                    case r_utils::json::JsonType::Int:
-                        result << value.asInt(); break;
-                    case r_utils::json::JsonType::Double:
-                        result << value.asDouble(); break;
-                    case r_utils::json::JsonType::Boolean:
-                        result << (value.asBoolean() ? "true" : "false"); break;
-                    case r_utils::json::JsonType::Array:
-                        result << value.asArray().toString(); break;
-                    case r_utils::json::JsonType::Object:
-                        result << value.asObject().toString(prettyPrint, indentLevel + 1); break;
-                    default:
-                        break;
+                    if (values[i].first == key) return i;
                 }
+                return values.size();
+            }
 
+            const size_t mask = index.size() - 1;
+            for (size_t slot = hashKey(key) & mask; index[slot] != 0; slot = (slot + 1) & mask)
+            {
+                const size_t position = index[slot] - 1;
+                if (values[position].first == key) return position;
+            }
+            return values.size();
+        }
 
-                counter++;
-
-                if (counter < this->size())
+        size_t JsonObject::findKey(const JsonKey& key) const
+        {
+            if (index.empty())
+            {
+                for (size_t i = 0; i < values.size(); ++i)
                 {
-                    result << ",";
+                    if (values[i].first == key) return i;
                 }
+                return values.size();
+            }
+            return find(key);
+        }
 
-                if (prettyPrint)
-                {
-                    result << "\n";
-                }
+        void JsonObject::rebuildIndex()
+        {
+            index.clear();
+            if (values.size() <= INDEX_THRESHOLD)
+            {
+                return;
             }
 
-            if (prettyPrint && !values.empty())
+            index.assign(std::bit_ceil(values.size() * 2), 0);
+            for (size_t i = 0; i < values.size(); ++i)
             {
-                result << indent(indentLevel);
+                indexMember(i);
             }
+        }
 
-            result << "}";
+        void JsonObject::indexMember(size_t position)
+        {
+            const size_t mask = index.size() - 1;
+            size_t slot = hashKey(values[position].first) & mask;
+            while (index[slot] != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+            index[slot] = static_cast<uint32_t>(position + 1);
+        }
 
-            return result.str();
+        std::string JsonObject::toString(bool prettyPrint, int indentLevel) const
+        {
+            JsonSerializer serializer(prettyPrint);
+            serializer.write(*this, indentLevel);
+            return serializer.take();
         }
 
         r_utils::json::Json JsonObject::toJson() const 
@@ -153,8 +229,22 @@ namespace r_utils
         }
 
         bool operator==(const r_utils::json::JsonObject& x, const r_utils::json::JsonObject& y)
-        {   
-            return (x.getValues() == y.getValues());
+        {
+            // Member order is not significant in JSON.
+            if (x.size() != y.size())
+            {
+                return false;
+            }
+
+            for (const auto& [key, value] : x)
+            {
+                const JsonElement* other = y.tryGet(key);
+                if (other == nullptr || *other != value)
+                {
+                    return false;
+                }
+            }
+            return true;
         }
 
         bool operator!=(const r_utils::json::JsonObject& x, const r_utils::json::JsonObject& y)
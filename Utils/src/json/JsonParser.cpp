@@ -1,16 +1,25 @@
 #include "json/JsonParser.h"
 
+#include "file/MappedFile.h"
 #include "exception/json/JsonParserException.h"
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <exception>
+#include <thread>
+
 namespace r_utils
 {
 	namespace json
 	{
 
-		JsonElement JsonParser::parse(const std::string& input)
+		JsonElement JsonParser::parse(std::string_view input)
 		{
 			JsonParser parser(input);
-			return parser.parseValue();
+			JsonElement result = parser.parseValue();
+			parser.expectEnd();
+			return result;
 		}
 
 		JsonElement JsonParser::parse(const r_utils::io::File& file)
@@ -19,148 +28,658 @@ namespace r_utils
 			{
 				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
 			}
-			return parse(file.read().c_str());
+
+			const std::string buffer = file.read();
+			return parse(std::string_view(buffer));
 		}
 
+		JsonElement JsonParser::parse(std::string_view input, JsonKeyPool& keyPool)
+		{
+			JsonParser parser(input);
+			parser.keyPool = &keyPool;
+			JsonElement result = parser.parseValue();
+			parser.expectEnd();
+			return result;
+		}
 
-		JsonParser::JsonParser(std::string input)
-			: input(input), pos(0) {}
+		JsonElement JsonParser::parse(const r_utils::io::File& file, JsonKeyPool& keyPool)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
 
+			const std::string buffer = file.read();
+			return parse(std::string_view(buffer), keyPool);
+		}
 
-		char JsonParser::peek() const
+		JsonElement JsonParser::parse(std::string_view input, const JsonProjection& projection)
 		{
-			return pos < input.size() ? input[pos] : '\0';
+			JsonParser parser(input);
+			parser.projection = &projection;
+
+			JsonElement result;
+			parser.parseProjected(JsonProjection::ROOT, true, result);
+			parser.expectEnd();
+			return result;
 		}
 
-		char JsonParser::next()
+		JsonElement JsonParser::parse(const r_utils::io::File& file, const JsonProjection& projection)
 		{
-			return pos < input.size() ? input[pos++] : '\0';
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			return parse(std::string_view(buffer), projection);
 		}
 
-		bool JsonParser::eof() const
+		void JsonParser::parse(std::string_view input, IJsonHandler& handler)
 		{
-			return pos >= input.size();
+			JsonParser parser(input);
+			parser.emitValue(handler);
+			parser.expectEnd();
 		}
 
-		void JsonParser::skipWhitespace()
+		void JsonParser::parse(const r_utils::io::File& file, IJsonHandler& handler)
 		{
-			while (!eof() && std::isspace(static_cast<unsigned char>(peek()))) {
-				next();
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
 			}
+
+			const r_utils::io::MappedFile mapping(file, r_utils::io::MappedFile::Access::Sequential);
+			parse(mapping.getView(), handler);
 		}
 
-		JsonElement JsonParser::parseValue()
+		/**
+		 * @brief Finds where to cut a top-level array into ranges of whole elements.
+		 *
+		 * Walks the structural index once, keeping a stack of the closers the open brackets
+		 * expect so that mismatched brackets are rejected as the sequential parser would.
+		 * The first bound is the opening bracket, the last the closing bracket, and the ones
+		 * in between are top-level commas at least rangeSize bytes apart. Range i lies between
+		 * bounds i and i + 1.
+		 */
+		static std::vector<size_t> splitTopLevelArray(std::string_view input, size_t rangeSize, size_t windowSize)
 		{
-			skipWhitespace();
-			char c = peek();
+			std::vector<size_t> bounds;
+			std::vector<char> closers;
+			JsonStructuralIndex index(input, windowSize);
+			bool closed = false;
 
-			if (c == 'n') return parseNull();
-			if (c == 't' || c == 'f') return parseBool();
-			if (c == '"' || c == '\'') return parseString();
-			if ((c >= '0' && c <= '9') || c == '-' || c == '+') return parseNumber();
-			if (c == '{') return parseObject();
-			if (c == '[') return parseArray();
+			do
+			{
+				for (const uint32_t position : index.getPositions())
+				{
+					const char c = input[position];
+					if (closed)
+					{
+						throw r_utils::exception::JsonParserException("Unexpected character after value: " + std::string(1, c));
+					}
 
-			throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+					switch (c)
+					{
+						case '[':
+						case '{':
+							if (closers.empty()) bounds.push_back(position);
+							closers.push_back(c == '[' ? ']' : '}');
+							break;
+						case ']':
+						case '}':
+							if (closers.empty() || closers.back() != c)
+							{
+								throw r_utils::exception::JsonParserException(closers.empty() || closers.back() == ']'
+									? "Expected ',' or ']' in array, got '" + std::string(1, c) + "'"
+									: std::string("Expected ',' or '}' in object"));
+							}
+							closers.pop_back();
+							if (closers.empty())
+							{
+								bounds.push_back(position);
+								closed = true;
+							}
+							break;
+						case ',':
+							if (closers.size() == 1 && position - bounds.back() >= rangeSize) bounds.push_back(position);
+							break;
+						default:
+							break;
+					}
+				}
+			} while (index.advance());
+
+			if (!closed)
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input in array");
+			}
+			return bounds;
 		}
 
-		JsonElement JsonParser::parseNull()
+		JsonElement JsonParser::parseParallel(std::string_view input, unsigned int threadCount)
+		{
+			if (threadCount == 0)
+			{
+				threadCount = std::max(1u, std::thread::hardware_concurrency());
+			}
+
+			const size_t first = input.find_first_not_of(" \t\n\r");
+			if (threadCount == 1 || input.size() < PARALLEL_MIN_SIZE || first == std::string_view::npos || input[first] != '[')
+			{
+				return parse(input);
+			}
+
+			const size_t rangeSize = std::max(input.size() / (threadCount * PARALLEL_RANGES_PER_THREAD), INDEX_WINDOW_SIZE);
+			const std::vector<size_t> bounds = splitTopLevelArray(input, rangeSize, INDEX_WINDOW_SIZE);
+			const size_t rangeCount = bounds.size() - 1;
+			if (rangeCount == 1)
+			{
+				return parse(input);
+			}
+
+			std::vector<std::vector<JsonElement>> ranges(rangeCount);
+			std::vector<std::exception_ptr> errors(rangeCount);
+			std::atomic<size_t> nextRange = 0;
+
+			auto work = [&]() {
+				for (size_t range = nextRange++; range < rangeCount; range = nextRange++)
+				{
+					try
+					{
+						JsonParser parser(input.substr(bounds[range] + 1, bounds[range + 1] - bounds[range] - 1));
+						parser.parseElements(ranges[range]);
+					}
+					catch (...)
+					{
+						errors[range] = std::current_exception();
+					}
+				}
+			};
+
+			{
+				std::vector<std::jthread> workers;
+				workers.reserve(threadCount);
+				for (unsigned int i = 0; i < threadCount && i < rangeCount; ++i)
+				{
+					workers.emplace_back(work);
+				}
+			}
+
+			size_t total = 0;
+			for (size_t range = 0; range < rangeCount; ++range)
+			{
+				if (errors[range])
+				{
+					std::rethrow_exception(errors[range]);
+				}
+				total += ranges[range].size();
+			}
+
+			JsonArray array;
+			array.reserve(total);
+			for (std::vector<JsonElement>& elements : ranges)
+			{
+				for (JsonElement& element : elements)
+				{
+					array.add(std::move(element));
+				}
+				std::vector<JsonElement>().swap(elements);
+			}
+			return JsonElement(std::move(array));
+		}
+
+		JsonElement JsonParser::parseParallel(const r_utils::io::File& file, unsigned int threadCount)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			return parseParallel(std::string_view(buffer), threadCount);
+		}
+
+
+		/**
+		 * @brief Tells whether a literal that from_chars reported as out of range is too small rather than too large.
+		 *
+		 * from_chars only reports a range error when the value rounds to zero or to infinity,
+		 * so the decimal order of the first significant digit plus the exponent decides.
+		 */
+		static bool isBelowDoubleRange(std::string_view literal)
+		{
+			long long order = 0;
+			bool significant = false;
+			bool fraction = false;
+			size_t i = 0;
+			for (; i < literal.size() && literal[i] != 'e' && literal[i] != 'E'; ++i)
+			{
+				const char c = literal[i];
+				if (c == '.')
+				{
+					fraction = true;
+				}
+				else if (c >= '0' && c <= '9')
+				{
+					if (fraction && !significant) order--;
+					else if (significant && !fraction) order++;
+					significant = significant || c != '0';
+				}
+			}
+
+			long long exponent = 0;
+			bool negative = false;
+			if (i < literal.size())
+			{
+				i++;
+				if (i < literal.size() && (literal[i] == '-' || literal[i] == '+'))
+				{
+					negative = literal[i++] == '-';
+				}
+				for (; i < literal.size(); ++i)
+				{
+					// Anything beyond this is out of range either way.
+					exponent = std::min(exponent * 10 + (literal[i] - '0'), 100000LL);
+				}
+			}
+			return order + (negative ? -exponent : exponent) < 0;
+		}
+
+		JsonElement JsonParser::toNumber(std::string_view literal)
+		{
+			const char* begin = literal.data();
+			const char* end = begin + literal.size();
+			if (begin != end && *begin == '+') begin++;
+
+			const char* digits = (begin != end && *begin == '-' && begin == literal.data()) ? begin + 1 : begin;
+			if (digits != end && *digits >= '0' && *digits <= '9')
+			{
+				if (std::string_view(begin, end - begin).find_first_of(".eE") == std::string_view::npos)
+				{
+					int value;
+					auto [ptr, ec] = std::from_chars(begin, end, value);
+					if (ec == std::errc() && ptr == end)
+					{
+						return JsonElement(value);
+					}
+				}
+
+				double value;
+				auto [ptr, ec] = std::from_chars(begin, end, value);
+				if (ec == std::errc() && ptr == end)
+				{
+					return JsonElement(value);
+				}
+				if (ec == std::errc::result_out_of_range && ptr == end)
+				{
+					// Values too small for a double underflow to zero; values too large are an error.
+					if (isBelowDoubleRange(literal))
+					{
+						return JsonElement(digits != begin ? -0.0 : 0.0);
+					}
+					throw r_utils::exception::JsonParserException("Number out of range: " + std::string(literal));
+				}
+			}
+
+			throw r_utils::exception::JsonParserException("Invalid number: " + std::string(literal));
+		}
+
+		void JsonParser::emitNumber(std::string_view literal, IJsonHandler& handler)
+		{
+			const JsonElement number = toNumber(literal);
+			if (number.isInt())
+			{
+				handler.onInt(number.asInt());
+				return;
+			}
+
+			if (literal.find_first_of(".eE") == std::string_view::npos)
+			{
+				const char* begin = literal.data() + (literal.front() == '+' ? 1 : 0);
+				const char* end = literal.data() + literal.size();
+
+				int64_t signedValue;
+				auto [signedEnd, signedError] = std::from_chars(begin, end, signedValue);
+				if (signedError == std::errc() && signedEnd == end)
+				{
+					handler.onInt64(signedValue);
+					return;
+				}
+
+				uint64_t unsignedValue;
+				auto [unsignedEnd, unsignedError] = std::from_chars(begin, end, unsignedValue);
+				if (unsignedError == std::errc() && unsignedEnd == end)
+				{
+					handler.onUint64(unsignedValue);
+					return;
+				}
+			}
+
+			handler.onNumber(number.asDouble());
+		}
+
+		/**
+		 * @brief Reads the four hex digits of a \u escape starting at text[start].
+		 * @return False if the text ends before all four digits.
+		 */
+		static bool readCodeUnit(std::string_view text, size_t start, uint32_t& unit)
+		{
+			unit = 0;
+			for (size_t i = start; i < start + 4; ++i)
+			{
+				if (i >= text.size()) return false;
+
+				const char c = text[i];
+				uint32_t digit;
+				if (c >= '0' && c <= '9') digit = c - '0';
+				else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+				else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+				else throw r_utils::exception::JsonParserException("Invalid escape: \\" + std::string(text.substr(0, i + 1)));
+				unit = unit << 4 | digit;
+			}
+			return true;
+		}
+
+		/** @brief Appends a code point as UTF-8. */
+		static void appendUtf8(uint32_t codePoint, std::string& out)
+		{
+			if (codePoint < 0x80)
+			{
+				out += static_cast<char>(codePoint);
+			}
+			else if (codePoint < 0x800)
+			{
+				out += static_cast<char>(0xC0 | codePoint >> 6);
+				out += static_cast<char>(0x80 | (codePoint & 0x3F));
+			}
+			else if (codePoint < 0x10000)
+			{
+				out += static_cast<char>(0xE0 | codePoint >> 12);
+				out += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+				out += static_cast<char>(0x80 | (codePoint & 0x3F));
+			}
+			else
+			{
+				out += static_cast<char>(0xF0 | codePoint >> 18);
+				out += static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+				out += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+				out += static_cast<char>(0x80 | (codePoint & 0x3F));
+			}
+		}
+
+		size_t JsonParser::unescape(std::string_view escape, std::string& out)
+		{
+			if (escape.empty()) return 0;
+
+			switch (escape[0]) {
+				case 'n': out += '\n'; return 1;
+				case 't': out += '\t'; return 1;
+				case 'r': out += '\r'; return 1;
+				case 'b': out += '\b'; return 1;
+				case 'f': out += '\f'; return 1;
+				case 'u': break;
+				default: out += escape[0]; return 1;
+			}
+
+			uint32_t unit;
+			if (!readCodeUnit(escape, 1, unit)) return 0;
+			if (unit >= 0xDC00 && unit <= 0xDFFF)
+			{
+				throw r_utils::exception::JsonParserException("Unpaired surrogate: \\" + std::string(escape.substr(0, 5)));
+			}
+			if (unit < 0xD800 || unit > 0xDBFF)
+			{
+				appendUtf8(unit, out);
+				return 5;
+			}
+
+			// A high surrogate must be followed by an escaped low surrogate.
+			for (size_t i = 5; i < 7; ++i)
+			{
+				if (i >= escape.size()) return 0;
+				if (escape[i] != "\\u"[i - 5])
+				{
+					throw r_utils::exception::JsonParserException("Unpaired surrogate: \\" + std::string(escape.substr(0, 5)));
+				}
+			}
+			uint32_t low;
+			if (!readCodeUnit(escape, 7, low)) return 0;
+			if (low < 0xDC00 || low > 0xDFFF)
+			{
+				throw r_utils::exception::JsonParserException("Unpaired surrogate: \\" + std::string(escape.substr(0, 5)));
+			}
+			appendUtf8(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00), out);
+			return 11;
+		}
+
+
+		JsonParser::JsonParser(std::string_view input)
+			: input(input), index(input, INDEX_WINDOW_SIZE), cursor(0) {}
+
+
+		static bool isDelimiter(char c)
+		{
+			switch (c)
+			{
+				case ' ': case '\t': case '\n': case '\r':
+				case '{': case '}': case '[': case ']': case ':': case ',':
+					return true;
+				default:
+					return false;
+			}
+		}
+
+		char JsonParser::peek()
+		{
+			return eof() ? '\0' : input[index[cursor]];
+		}
+
+		size_t JsonParser::next()
+		{
+			if (eof())
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input");
+			}
+			return index[cursor++];
+		}
+
+		bool JsonParser::eof()
+		{
+			while (cursor >= index.size())
+			{
+				if (!index.advance())
+				{
+					return true;
+				}
+				cursor = 0;
+			}
+			return false;
+		}
+
+		void JsonParser::expectDelimiter(size_t end) const
+		{
+			if (end < input.size() && !isDelimiter(input[end]))
+			{
+				throw r_utils::exception::JsonParserException("Unexpected character after value: " + std::string(1, input[end]));
+			}
+		}
+
+		void JsonParser::expectEnd()
+		{
+			if (!eof())
+			{
+				throw r_utils::exception::JsonParserException("Unexpected character after value: " + std::string(1, peek()));
+			}
+		}
+
+
+		void JsonParser::readNull()
 		{
-			if (input.substr(pos, 4) == "null") 
+			size_t pos = next();
+			if (input.compare(pos, 4, "null") == 0)
 			{
-				pos += 4;
-				return JsonElement(nullptr);
+				expectDelimiter(pos + 4);
+				return;
 			}
 			throw r_utils::exception::JsonParserException("Invalid null value");
 		}
 
-		JsonElement JsonParser::parseBool()
+		bool JsonParser::readBool()
 		{
-			if (input.substr(pos, 4) == "true") 
+			size_t pos = next();
+			if (input.compare(pos, 4, "true") == 0)
 			{
-				pos += 4;
-				return JsonElement(true);
+				expectDelimiter(pos + 4);
+				return true;
 			}
-			else if (input.substr(pos, 5) == "false") 
+			else if (input.compare(pos, 5, "false") == 0)
 			{
-				pos += 5;
-				return JsonElement(false);
+				expectDelimiter(pos + 5);
+				return false;
 			}
 			throw r_utils::exception::JsonParserException("Invalid boolean value");
 		}
 
-		JsonElement JsonParser::parseNumber()
+		std::string_view JsonParser::readNumberLiteral()
 		{
-			size_t start = pos;
-			if (peek() == '-') next();
-			while (std::isdigit(peek())) next();
-			if (peek() == '.') 
+			size_t start = next();
+			size_t end = start;
+
+			auto isDigit = [this](size_t i) { return i < input.size() && input[i] >= '0' && input[i] <= '9'; };
+
+			if (input[end] == '-' || input[end] == '+') end++;
+			while (isDigit(end)) end++;
+			if (end < input.size() && input[end] == '.')
 			{
-				next();
-				while (std::isdigit(peek())) next();
+				end++;
+				while (isDigit(end)) end++;
+			}
+			if (end < input.size() && (input[end] == 'e' || input[end] == 'E'))
+			{
+				end++;
+				if (end < input.size() && (input[end] == '-' || input[end] == '+')) end++;
+				while (isDigit(end)) end++;
 			}
-			std::string numStr = std::string(input.substr(start, pos - start));
-			return JsonElement(std::stod(numStr));
+			expectDelimiter(end);
+
+			return input.substr(start, end - start);
 		}
 
-		JsonElement JsonParser::parseString()
+		JsonElement JsonParser::readNumber()
 		{
-			char quote = next();
-			std::string result;
-			while (!eof()) 
-			{
-				char c = next();
-				if (c == quote) break;
-				if (c == '\\') 
-				{
-					char esc = next();
-					switch (esc) {
-						case 'n': result += '\n'; break;
-						case 't': result += '\t'; break;
-						case '\\': result += '\\'; break;
-						case '"': result += '"'; break;
-						case '\'': result += '\''; break;
-						default: result += esc; break;
+			return toNumber(readNumberLiteral());
+		}
+
+		std::string_view JsonParser::readString()
+		{
+			size_t pos = next();
+			const char quote = input[pos];
+			if (quote != '"' && quote != '\'')
+			{
+				throw r_utils::exception::JsonParserException("Expected string, got '" + std::string(1, quote) + "'");
+			}
+
+			size_t runStart = pos + 1;
+			bool escaped = false;
+			for (size_t i = runStart; i < input.size(); ++i)
+			{
+				char c = input[i];
+				if (c == quote)
+				{
+					if (!escaped)
+					{
+						return input.substr(runStart, i - runStart);
 					}
+					unescaped.append(input.substr(runStart, i - runStart));
+					return unescaped;
 				}
-				else 
+				if (c == '\\')
 				{
-					result += c;
+					if (!escaped)
+					{
+						unescaped.clear();
+						escaped = true;
+					}
+					unescaped.append(input.substr(runStart, i - runStart));
+					const size_t length = unescape(input.substr(i + 1), unescaped);
+					if (length == 0) break;
+
+					i += length;
+					runStart = i + 1;
 				}
 			}
-			return JsonElement(result);
+			throw r_utils::exception::JsonParserException("Unterminated string");
+		}
+
+
+		JsonElement JsonParser::parseValue()
+		{
+			if (eof())
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input");
+			}
+
+			char c = peek();
+
+			if (c == 'n') return parseNull();
+			if (c == 't' || c == 'f') return parseBool();
+			if (c == '"' || c == '\'') return parseString();
+			if ((c >= '0' && c <= '9') || c == '-' || c == '+') return parseNumber();
+			if (c == '{') return parseObject();
+			if (c == '[') return parseArray();
+
+			throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+		}
+
+		JsonElement JsonParser::parseNull()
+		{
+			readNull();
+			return JsonElement(nullptr);
+		}
+
+		JsonElement JsonParser::parseBool()
+		{
+			return JsonElement(readBool());
+		}
+
+		JsonElement JsonParser::parseNumber()
+		{
+			return readNumber();
+		}
+
+		JsonElement JsonParser::parseString()
+		{
+			return JsonElement(std::string(readString()));
 		}
 
 		JsonArray JsonParser::parseArray()
 		{
 			JsonArray array;
 
-			if (next() != '[')
+			if (input[next()] != '[')
 				throw r_utils::exception::JsonParserException("Expected '[' to start array");
 
-			skipWhitespace();
-			if (peek() == ']') 
+			if (peek() == ']')
 			{
 				next();
 				return array;
 			}
 
-			while (!eof()) 
+			while (true)
 			{
-				skipWhitespace();
 				JsonElement element = parseValue();
-				array.add(element);
+				array.add(std::move(element));
 
-				skipWhitespace();
 				if (eof())
 					throw r_utils::exception::JsonParserException("Unexpected end of input in array");
 
-				char ch = next();
-				if (ch == ']') 
+				char ch = input[next()];
+				if (ch == ']')
 				{
 					break;
 				}
-				else if (ch != ',') 
+				else if (ch != ',')
 				{
 					throw r_utils::exception::JsonParserException("Expected ',' or ']' in array, got '" + std::string(1, ch) + "'");
 				}
@@ -169,46 +688,58 @@ namespace r_utils
 			return array;
 		}
 
+		void JsonParser::parseElements(std::vector<JsonElement>& elements)
+		{
+			while (true)
+			{
+				elements.push_back(parseValue());
+				if (eof())
+				{
+					return;
+				}
+
+				const char ch = input[next()];
+				if (ch != ',')
+				{
+					throw r_utils::exception::JsonParserException("Expected ',' or ']' in array, got '" + std::string(1, ch) + "'");
+				}
+			}
+		}
+
 		JsonObject JsonParser::parseObject()
 		{
 			JsonObject obj;
 
-			if (next() != '{') 
+			if (input[next()] != '{')
 			{
 				throw r_utils::exception::JsonParserException("Expected '{'");
 			}
 
-			skipWhitespace();
-			if (peek() == '}') 
+			if (peek() == '}')
 			{
 				next();
 				return obj;
 			}
 
-			while (!eof()) 
+			while (true)
 			{
-				skipWhitespace();
-				auto keyElement = parseString();
-				std::string key = keyElement.asString();
+				JsonKey key = keyPool ? keyPool->intern(readString()) : JsonKey(readString());
 
-				skipWhitespace();
-				if (next() != ':') 
+				if (eof() || input[next()] != ':')
 				{
 					throw r_utils::exception::JsonParserException("Expected ':' after key");
 				}
 
-				skipWhitespace();
 				JsonElement value = parseValue();
 
-				obj.set(key, value);
+				obj.set(key, std::move(value));
 
-				skipWhitespace();
-				if (peek() == ',') 
+				if (peek() == ',')
 				{
 					next();
 					continue;
 				}
-				if (peek() == '}') 
+				if (peek() == '}')
 				{
 					next();
 					break;
@@ -218,5 +749,232 @@ namespace r_utils
 
 			return obj;
 		}
+
+
+		void JsonParser::skipValue()
+		{
+			char c = peek();
+			if (c != '{' && c != '[')
+			{
+				if (c == '\0' || c == '}' || c == ']' || c == ',' || c == ':')
+				{
+					throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+				}
+				next();
+				return;
+			}
+
+			// Strings, scalars, ':' and ',' sit on the index as single positions, so only brackets
+			// need to be tracked. Each closer must match the innermost open bracket.
+			closers.clear();
+			do
+			{
+				c = input[next()];
+				if (c == '{' || c == '[')
+				{
+					closers.push_back(c == '[' ? ']' : '}');
+				}
+				else if (c == '}' || c == ']')
+				{
+					if (closers.back() != c)
+					{
+						throw r_utils::exception::JsonParserException(closers.back() == ']'
+							? "Expected ',' or ']' in array, got '" + std::string(1, c) + "'"
+							: std::string("Expected ',' or '}' in object"));
+					}
+					closers.pop_back();
+				}
+			} while (!closers.empty());
+		}
+
+		bool JsonParser::parseProjected(uint32_t node, bool keepEmpty, JsonElement& out)
+		{
+			if (projection->isSelected(node))
+			{
+				out = parseValue();
+				return true;
+			}
+
+			const char c = peek();
+			if (c == '{')
+			{
+				next();
+				JsonObject obj;
+				if (peek() == '}')
+				{
+					next();
+				}
+				else while (true)
+				{
+					std::string_view name = readString();
+					const uint32_t child = projection->child(node, name);
+					JsonKey key;
+					if (child != JsonProjection::NONE)
+					{
+						key = keyPool ? keyPool->intern(name) : JsonKey(name);
+					}
+
+					if (eof() || input[next()] != ':')
+					{
+						throw r_utils::exception::JsonParserException("Expected ':' after key");
+					}
+
+					JsonElement value;
+					if (child == JsonProjection::NONE) skipValue();
+					else if (parseProjected(child, false, value)) obj.set(key, std::move(value));
+
+					if (peek() == ',')
+					{
+						next();
+						continue;
+					}
+					if (peek() == '}')
+					{
+						next();
+						break;
+					}
+					throw r_utils::exception::JsonParserException("Expected ',' or '}' in object");
+				}
+
+				if (obj.empty() && !keepEmpty) return false;
+				out = std::move(obj);
+				return true;
+			}
+
+			if (c == '[')
+			{
+				next();
+				JsonArray array;
+				if (peek() == ']')
+				{
+					next();
+				}
+				else for (size_t i = 0; ; ++i)
+				{
+					const uint32_t child = projection->child(node, i);
+					JsonElement value;
+					if (child == JsonProjection::NONE) skipValue();
+					else if (parseProjected(child, projection->hasWildcard(node), value)) array.add(std::move(value));
+
+					if (eof())
+						throw r_utils::exception::JsonParserException("Unexpected end of input in array");
+
+					char ch = input[next()];
+					if (ch == ']')
+					{
+						break;
+					}
+					else if (ch != ',')
+					{
+						throw r_utils::exception::JsonParserException("Expected ',' or ']' in array, got '" + std::string(1, ch) + "'");
+					}
+				}
+
+				if (array.empty() && !keepEmpty) return false;
+				out = std::move(array);
+				return true;
+			}
+
+			skipValue();
+			if (keepEmpty) out = JsonElement(nullptr);
+			return keepEmpty;
+		}
+
+
+		void JsonParser::emitValue(IJsonHandler& handler)
+		{
+			if (eof())
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input");
+			}
+
+			char c = peek();
+
+			if (c == 'n') { readNull(); handler.onNull(); }
+			else if (c == 't' || c == 'f') handler.onBoolean(readBool());
+			else if (c == '"' || c == '\'') handler.onString(readString());
+			else if ((c >= '0' && c <= '9') || c == '-' || c == '+') emitNumber(readNumberLiteral(), handler);
+			else if (c == '{') emitObject(handler);
+			else if (c == '[') emitArray(handler);
+			else throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+		}
+
+		void JsonParser::emitArray(IJsonHandler& handler)
+		{
+			if (input[next()] != '[')
+				throw r_utils::exception::JsonParserException("Expected '[' to start array");
+
+			handler.onStartArray();
+
+			if (peek() == ']')
+			{
+				next();
+				handler.onEndArray();
+				return;
+			}
+
+			while (true)
+			{
+				emitValue(handler);
+
+				if (eof())
+					throw r_utils::exception::JsonParserException("Unexpected end of input in array");
+
+				char ch = input[next()];
+				if (ch == ']')
+				{
+					break;
+				}
+				else if (ch != ',')
+				{
+					throw r_utils::exception::JsonParserException("Expected ',' or ']' in array, got '" + std::string(1, ch) + "'");
+				}
+			}
+
+			handler.onEndArray();
+		}
+
+		void JsonParser::emitObject(IJsonHandler& handler)
+		{
+			if (input[next()] != '{')
+			{
+				throw r_utils::exception::JsonParserException("Expected '{'");
+			}
+
+			handler.onStartObject();
+
+			if (peek() == '}')
+			{
+				next();
+				handler.onEndObject();
+				return;
+			}
+
+			while (true)
+			{
+				handler.onKey(readString());
+
+				if (eof() || input[next()] != ':')
+				{
+					throw r_utils::exception::JsonParserException("Expected ':' after key");
+				}
+
+				emitValue(handler);
+
+				if (peek() == ',')
+				{
+					next();
+					continue;
+				}
+				if (peek() == '}')
+				{
+					next();
+					break;
+				}
+				throw r_utils::exception::JsonParserException("Expected ',' or '}' in object");
+			}
+
+			handler.onEndObject();
+		}
 	} // json
 } // r_utils
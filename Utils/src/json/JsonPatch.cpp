@@ -0,0 +1,494 @@
+#include "json/JsonPatch.h"
+#include "json/JsonPointer.h"
+
+#include "exception/json/JsonPatchException.h"
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/** @brief Arrays whose unmatched middle parts span more cells are paired by position instead of by LCS. */
+		static constexpr size_t LCS_CELL_LIMIT = 4 * 1024 * 1024;
+
+		[[noreturn]] static void fail(size_t operation, const std::string& reason)
+		{
+			throw r_utils::exception::JsonPatchException("JSON patch operation " + std::to_string(operation) + " failed: " + reason);
+		}
+
+		/**
+		 * @class JsonDiffBuilder
+		 * @brief Walks two documents side by side and records the operations between them.
+		 *
+		 * Subtrees are compared with operator==, which accepts shared subtrees without
+		 * visiting them; only subtrees that differ are descended into. Cached hashes only
+		 * guide how array elements are paired, so a stale hash can make a patch longer
+		 * but never wrong.
+		 */
+		class JsonDiffBuilder
+		{
+		public:
+			explicit JsonDiffBuilder(JsonArray& operations)
+				: operations(operations)
+			{}
+
+			void diff(const JsonElement& source, const JsonElement& target, const std::string& path)
+			{
+				if (source.sharesWith(target))
+				{
+					return;
+				}
+
+				if (source.isObject() && target.isObject())
+				{
+					if (source != target)
+					{
+						diffObjects(source.asObject(), target.asObject(), path);
+					}
+				}
+				else if (source.isArray() && target.isArray())
+				{
+					if (source != target)
+					{
+						diffArrays(source.asArray().getValues(), target.asArray().getValues(), path);
+					}
+				}
+				else if (source != target)
+				{
+					record("replace", path, &target);
+				}
+			}
+
+		private:
+			/** One step of an edit script between two element ranges. */
+			enum class Edit { Keep, Remove, Insert };
+
+			void diffObjects(const JsonObject& source, const JsonObject& target, const std::string& path)
+			{
+				for (const auto& [key, value] : source)
+				{
+					const std::string memberPath = path + '/' + JsonPointer::escape(key);
+					const JsonElement* other = target.tryGet(key);
+					if (other == nullptr)
+					{
+						record("remove", memberPath, nullptr);
+					}
+					else
+					{
+						diff(value, *other, memberPath);
+					}
+				}
+
+				for (const auto& [key, value] : target)
+				{
+					if (!source.contains(key))
+					{
+						record("add", path + '/' + JsonPointer::escape(key), &value);
+					}
+				}
+			}
+
+			void diffArrays(const std::vector<JsonElement>& source, const std::vector<JsonElement>& target, const std::string& path)
+			{
+				size_t prefix = 0;
+				while (prefix < source.size() && prefix < target.size() && source[prefix] == target[prefix])
+				{
+					++prefix;
+				}
+
+				size_t suffix = 0;
+				while (suffix < source.size() - prefix && suffix < target.size() - prefix
+					&& source[source.size() - 1 - suffix] == target[target.size() - 1 - suffix])
+				{
+					++suffix;
+				}
+
+				const size_t n = source.size() - prefix - suffix;
+				const size_t m = target.size() - prefix - suffix;
+				const std::vector<Edit> edits = editScript(source.data() + prefix, n, target.data() + prefix, m);
+
+				// Runs of removals and insertions between kept elements are paired up and
+				// patched in place; the rest are removed or added at the current position.
+				size_t i = prefix;
+				size_t j = prefix;
+				size_t position = prefix;
+				size_t edit = 0;
+				while (edit < edits.size())
+				{
+					if (edits[edit] == Edit::Keep)
+					{
+						diff(source[i++], target[j++], path + '/' + std::to_string(position++));
+						++edit;
+						continue;
+					}
+
+					size_t removals = 0;
+					size_t insertions = 0;
+					for (; edit < edits.size() && edits[edit] != Edit::Keep; ++edit)
+					{
+						(edits[edit] == Edit::Remove ? removals : insertions)++;
+					}
+
+					const size_t paired = std::min(removals, insertions);
+					for (size_t k = 0; k < paired; ++k)
+					{
+						diff(source[i++], target[j++], path + '/' + std::to_string(position++));
+					}
+					for (size_t k = paired; k < removals; ++k, ++i)
+					{
+						record("remove", path + '/' + std::to_string(position), nullptr);
+					}
+					for (size_t k = paired; k < insertions; ++k)
+					{
+						record("add", path + '/' + std::to_string(position++), &target[j++]);
+					}
+				}
+			}
+
+			/**
+			 * @brief Computes a shortest edit script between two ranges from their longest common subsequence.
+			 *
+			 * Ranges too large for the quadratic table are matched by position instead.
+			 */
+			std::vector<Edit> editScript(const JsonElement* source, size_t n, const JsonElement* target, size_t m)
+			{
+				std::vector<Edit> edits;
+				if (n == 0 || m == 0 || n * m > LCS_CELL_LIMIT)
+				{
+					const size_t common = std::min(n, m);
+					edits.assign(common, Edit::Keep);
+					edits.insert(edits.end(), n - common, Edit::Remove);
+					edits.insert(edits.end(), m - common, Edit::Insert);
+					return edits;
+				}
+
+				std::vector<uint64_t> sourceHashes(n);
+				std::vector<uint64_t> targetHashes(m);
+				for (size_t i = 0; i < n; ++i) sourceHashes[i] = source[i].hash();
+				for (size_t j = 0; j < m; ++j) targetHashes[j] = target[j].hash();
+
+				// lengths[i * (m + 1) + j] is the LCS length of source[i..] and target[j..].
+				std::vector<uint32_t> lengths((n + 1) * (m + 1), 0);
+				for (size_t i = n; i-- > 0;)
+				{
+					for (size_t j = m; j-- > 0;)
+					{
+						lengths[i * (m + 1) + j] = sourceHashes[i] == targetHashes[j]
+							? lengths[(i + 1) * (m + 1) + j + 1] + 1
+							: std::max(lengths[(i + 1) * (m + 1) + j], lengths[i * (m + 1) + j + 1]);
+					}
+				}
+
+				size_t i = 0;
+				size_t j = 0;
+				while (i < n && j < m)
+				{
+					if (sourceHashes[i] == targetHashes[j] && lengths[i * (m + 1) + j] == lengths[(i + 1) * (m + 1) + j + 1] + 1)
+					{
+						edits.push_back(Edit::Keep);
+						++i;
+						++j;
+					}
+					else if (lengths[(i + 1) * (m + 1) + j] >= lengths[i * (m + 1) + j + 1])
+					{
+						edits.push_back(Edit::Remove);
+						++i;
+					}
+					else
+					{
+						edits.push_back(Edit::Insert);
+						++j;
+					}
+				}
+				edits.insert(edits.end(), n - i, Edit::Remove);
+				edits.insert(edits.end(), m - j, Edit::Insert);
+				return edits;
+			}
+
+			void record(const char* op, const std::string& path, const JsonElement* value)
+			{
+				JsonObject operation;
+				operation.set("op", JsonElement(op));
+				operation.set("path", JsonElement(path));
+				if (value != nullptr)
+				{
+					operation.set("value", *value);
+				}
+				operations.add(JsonElement(std::move(operation)));
+			}
+
+			JsonArray& operations;
+		};
+
+
+		/** @brief Returns a required string member of an operation. */
+		static const std::string& stringMember(const JsonObject& operation, std::string_view name, size_t number)
+		{
+			const JsonElement* member = operation.tryGet(name);
+			if (member == nullptr || !member->isString())
+			{
+				fail(number, "missing string member \"" + std::string(name) + "\"");
+			}
+			return member->asString();
+		}
+
+		static JsonPointer pointerMember(const JsonObject& operation, std::string_view name, size_t number)
+		{
+			const std::string& text = stringMember(operation, name, number);
+			try
+			{
+				return JsonPointer(text);
+			}
+			catch (const r_utils::exception::Exception&)
+			{
+				fail(number, "invalid pointer \"" + text + "\"");
+			}
+		}
+
+		/** @brief Returns the container that holds the target of the pointer. */
+		static JsonElement& parentOf(JsonElement& document, const JsonPointer& pointer, size_t number)
+		{
+			JsonElement* parent = pointer.parent().evaluate(document);
+			if (parent == nullptr || (!parent->isObject() && !parent->isArray()))
+			{
+				fail(number, "path \"" + pointer.toString() + "\" has no parent container");
+			}
+			return *parent;
+		}
+
+		static void addValue(JsonElement& document, const JsonPointer& pointer, JsonElement value, size_t number)
+		{
+			if (pointer.isRoot())
+			{
+				document = std::move(value);
+				return;
+			}
+
+			JsonElement& parent = parentOf(document, pointer, number);
+			const JsonPointer::Token& token = pointer.getTokens().back();
+			if (parent.isObject())
+			{
+				parent.asObject().set(token.name, std::move(value));
+				return;
+			}
+
+			JsonArray& array = parent.asArray();
+			if (token.name == "-")
+			{
+				array.add(std::move(value));
+			}
+			else if (token.index >= 0 && token.index <= static_cast<int>(array.size()))
+			{
+				array.insert(token.index, std::move(value));
+			}
+			else
+			{
+				fail(number, "index out of bounds in \"" + pointer.toString() + "\"");
+			}
+		}
+
+		static JsonElement removeValue(JsonElement& document, const JsonPointer& pointer, size_t number)
+		{
+			if (pointer.isRoot())
+			{
+				fail(number, "cannot remove the whole document");
+			}
+
+			JsonElement& parent = parentOf(document, pointer, number);
+			const JsonPointer::Token& token = pointer.getTokens().back();
+			if (parent.isObject())
+			{
+				JsonElement* value = parent.asObject().tryGet(token.name);
+				if (value == nullptr)
+				{
+					fail(number, "path \"" + pointer.toString() + "\" does not exist");
+				}
+				JsonElement removed = std::move(*value);
+				parent.asObject().remove(token.name);
+				return removed;
+			}
+
+			JsonArray& array = parent.asArray();
+			if (token.index < 0 || token.index >= static_cast<int>(array.size()))
+			{
+				fail(number, "index out of bounds in \"" + pointer.toString() + "\"");
+			}
+			JsonElement removed = std::move(array[token.index]);
+			array.removeAt(token.index);
+			return removed;
+		}
+
+		static const JsonElement& valueMember(const JsonObject& operation, size_t number)
+		{
+			const JsonElement* value = operation.tryGet("value");
+			if (value == nullptr)
+			{
+				fail(number, "missing member \"value\"");
+			}
+			return *value;
+		}
+
+		static void applyOperation(JsonElement& document, const JsonElement& element, size_t number)
+		{
+			if (!element.isObject())
+			{
+				fail(number, "operation is not an object");
+			}
+
+			const JsonObject& operation = element.asObject();
+			const std::string& op = stringMember(operation, "op", number);
+			const JsonPointer path = pointerMember(operation, "path", number);
+
+			if (op == "add")
+			{
+				addValue(document, path, valueMember(operation, number), number);
+			}
+			else if (op == "remove")
+			{
+				removeValue(document, path, number);
+			}
+			else if (op == "replace")
+			{
+				JsonElement* target = path.evaluate(document);
+				if (target == nullptr)
+				{
+					fail(number, "path \"" + path.toString() + "\" does not exist");
+				}
+				*target = valueMember(operation, number);
+			}
+			else if (op == "move")
+			{
+				const JsonPointer from = pointerMember(operation, "from", number);
+				const auto& fromTokens = from.getTokens();
+				const auto& pathTokens = path.getTokens();
+				if (fromTokens.size() < pathTokens.size() && std::equal(fromTokens.begin(), fromTokens.end(), pathTokens.begin(),
+					[](const JsonPointer::Token& x, const JsonPointer::Token& y) { return x.name == y.name; }))
+				{
+					fail(number, "cannot move \"" + from.toString() + "\" into itself");
+				}
+				addValue(document, path, removeValue(document, from, number), number);
+			}
+			else if (op == "copy")
+			{
+				const JsonPointer from = pointerMember(operation, "from", number);
+				const JsonElement* source = from.evaluate(static_cast<const JsonElement&>(document));
+				if (source == nullptr)
+				{
+					fail(number, "path \"" + from.toString() + "\" does not exist");
+				}
+				addValue(document, path, *source, number);
+			}
+			else if (op == "test")
+			{
+				const JsonElement* target = path.evaluate(static_cast<const JsonElement&>(document));
+				if (target == nullptr || *target != valueMember(operation, number))
+				{
+					fail(number, "test of \"" + path.toString() + "\" failed");
+				}
+			}
+			else
+			{
+				fail(number, "unknown op \"" + op + "\"");
+			}
+		}
+
+
+		/** @brief Returns the value as a merge patch would produce it: object members that are null are dropped. */
+		static JsonElement withoutNulls(const JsonElement& value)
+		{
+			JsonElement result;
+			JsonPatch::merge(result, value);
+			return result;
+		}
+
+		static JsonElement buildMergePatch(const JsonElement& source, const JsonElement& target)
+		{
+			if (!source.isObject() || !target.isObject())
+			{
+				return withoutNulls(target);
+			}
+
+			JsonObject patch;
+			for (const auto& [key, value] : source.asObject())
+			{
+				if (!target.asObject().contains(key))
+				{
+					patch.set(key, JsonElement(nullptr));
+				}
+			}
+			for (const auto& [key, value] : target.asObject())
+			{
+				const JsonElement* previous = source.asObject().tryGet(key);
+				if (previous == nullptr)
+				{
+					patch.set(key, withoutNulls(value));
+				}
+				else if (*previous != value)
+				{
+					patch.set(key, buildMergePatch(*previous, value));
+				}
+			}
+			return JsonElement(std::move(patch));
+		}
+
+
+		void JsonPatch::apply(JsonElement& document, const JsonArray& patch)
+		{
+			// Work on a shared copy so that a failing operation leaves the document untouched.
+			JsonElement result = document;
+			for (size_t i = 0; i < patch.size(); ++i)
+			{
+				applyOperation(result, patch[static_cast<int>(i)], i);
+			}
+			document = std::move(result);
+		}
+
+		JsonArray JsonPatch::diff(const JsonElement& source, const JsonElement& target)
+		{
+			JsonArray operations;
+			JsonDiffBuilder(operations).diff(source, target, "");
+			return operations;
+		}
+
+		void JsonPatch::merge(JsonElement& document, const JsonElement& patch)
+		{
+			if (!patch.isObject())
+			{
+				document = patch;
+				return;
+			}
+
+			if (!document.isObject())
+			{
+				document = JsonObject();
+			}
+
+			JsonObject& object = document.asObject();
+			for (const auto& [key, value] : patch.asObject())
+			{
+				if (value.isNull())
+				{
+					object.remove(key);
+				}
+				else if (JsonElement* member = object.tryGet(key))
+				{
+					merge(*member, value);
+				}
+				else
+				{
+					JsonElement added;
+					merge(added, value);
+					object.set(key, std::move(added));
+				}
+			}
+		}
+
+		JsonElement JsonPatch::mergeDiff(const JsonElement& source, const JsonElement& target)
+		{
+			return buildMergePatch(source, target);
+		}
+	} // json
+} // r_utils
\ No newline at end of file
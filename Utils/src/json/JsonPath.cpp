@@ -0,0 +1,403 @@
+#include "json/JsonPath.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonPathException.h"
+
+#include <charconv>
+#include <limits>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/** @brief Calls visit for every array element or object member value until it returns true. */
+		template<typename Visitor>
+		static bool forEachChild(const JsonElement& node, Visitor&& visit)
+		{
+			if (node.isArray())
+			{
+				for (const JsonElement& child : node.asArray().getValues())
+				{
+					if (visit(child)) return true;
+				}
+			}
+			else if (node.isObject())
+			{
+				for (const auto& [key, child] : node.asObject())
+				{
+					if (visit(child)) return true;
+				}
+			}
+			return false;
+		}
+
+		static bool isNumber(const JsonElement& element)
+		{
+			return element.isInt() || element.isDouble();
+		}
+
+		static double toDouble(const JsonElement& element)
+		{
+			return element.isInt() ? element.asInt() : element.asDouble();
+		}
+
+
+		/**
+		 * @class JsonPath::Compiler
+		 * @brief Recursive-descent parser that turns an expression into steps.
+		 */
+		class JsonPath::Compiler
+		{
+		public:
+			explicit Compiler(std::string_view path)
+				: path(path)
+			{}
+
+			std::vector<Step> compile()
+			{
+				expect('$');
+
+				std::vector<Step> steps;
+				while (position < path.size())
+				{
+					steps.push_back(step());
+				}
+				return steps;
+			}
+
+		private:
+			Step step()
+			{
+				if (consume('.'))
+				{
+					if (consume('.'))
+					{
+						if (consume('*')) return Step{ StepType::DescendantWildcard };
+						return Step{ StepType::DescendantKey, name() };
+					}
+					if (consume('*')) return Step{ StepType::Wildcard };
+					return Step{ StepType::Key, name() };
+				}
+
+				expect('[');
+				skipSpaces();
+
+				Step result;
+				if (consume('*'))
+				{
+					result = Step{ StepType::Wildcard };
+				}
+				else if (consume('?'))
+				{
+					result = filter();
+				}
+				else if (peek() == '\'' || peek() == '"')
+				{
+					result = Step{ StepType::Key, quoted() };
+				}
+				else
+				{
+					result = Step{ StepType::Index, {}, integer() };
+				}
+
+				skipSpaces();
+				expect(']');
+				return result;
+			}
+
+			Step filter()
+			{
+				Step result{ StepType::Filter };
+
+				skipSpaces();
+				const bool parenthesized = consume('(');
+				skipSpaces();
+				expect('@');
+
+				while (peek() == '.' || peek() == '[')
+				{
+					if (consume('.'))
+					{
+						result.filterPath.push_back(Step{ StepType::Key, name() });
+						continue;
+					}
+
+					++position;
+					skipSpaces();
+					if (peek() == '\'' || peek() == '"')
+					{
+						result.filterPath.push_back(Step{ StepType::Key, quoted() });
+					}
+					else
+					{
+						result.filterPath.push_back(Step{ StepType::Index, {}, integer() });
+					}
+					skipSpaces();
+					expect(']');
+				}
+
+				skipSpaces();
+				result.filterOperator = comparison();
+				if (result.filterOperator != Operator::Exists)
+				{
+					skipSpaces();
+					result.filterValue = literal();
+				}
+
+				skipSpaces();
+				if (parenthesized) expect(')');
+				return result;
+			}
+
+			Operator comparison()
+			{
+				if (consume("==")) return Operator::Equal;
+				if (consume("!=")) return Operator::NotEqual;
+				if (consume("<=")) return Operator::LessEqual;
+				if (consume(">=")) return Operator::GreaterEqual;
+				if (consume('<')) return Operator::Less;
+				if (consume('>')) return Operator::Greater;
+				return Operator::Exists;
+			}
+
+			JsonElement literal()
+			{
+				if (peek() == '\'' || peek() == '"') return JsonElement(quoted());
+				if (consume("true")) return JsonElement(true);
+				if (consume("false")) return JsonElement(false);
+				if (consume("null")) return JsonElement(nullptr);
+
+				const size_t start = position;
+				while (position < path.size() && std::string_view("+-.eE0123456789").find(path[position]) != std::string_view::npos)
+				{
+					++position;
+				}
+				if (start == position) fail();
+
+				try
+				{
+					return JsonParser::toNumber(path.substr(start, position - start));
+				}
+				catch (const r_utils::exception::Exception&)
+				{
+					position = start;
+					fail();
+				}
+			}
+
+			std::string name()
+			{
+				const size_t start = position;
+				while (position < path.size() && std::string_view(".[]()=!<> ").find(path[position]) == std::string_view::npos)
+				{
+					++position;
+				}
+				if (start == position) fail();
+				return std::string(path.substr(start, position - start));
+			}
+
+			std::string quoted()
+			{
+				const char quote = path[position++];
+				std::string result;
+				while (position < path.size() && path[position] != quote)
+				{
+					if (path[position] == '\\' && position + 1 < path.size()) ++position;
+					result += path[position++];
+				}
+				expect(quote);
+				return result;
+			}
+
+			int integer()
+			{
+				int value = 0;
+				const auto [end, error] = std::from_chars(path.data() + position, path.data() + path.size(), value);
+				if (error != std::errc()) fail();
+				position = end - path.data();
+				return value;
+			}
+
+			char peek() const
+			{
+				return position < path.size() ? path[position] : '\0';
+			}
+
+			bool consume(char c)
+			{
+				if (peek() != c) return false;
+				++position;
+				return true;
+			}
+
+			bool consume(std::string_view token)
+			{
+				if (path.substr(position, token.size()) != token) return false;
+				position += token.size();
+				return true;
+			}
+
+			void expect(char c)
+			{
+				if (!consume(c)) fail();
+			}
+
+			void skipSpaces()
+			{
+				while (peek() == ' ') ++position;
+			}
+
+			[[noreturn]] void fail() const
+			{
+				throw r_utils::exception::JsonPathException("Invalid JSON path at position " + std::to_string(position) + ": " + std::string(path));
+			}
+
+			std::string_view path;
+			size_t position = 0;
+		};
+
+
+		JsonPath::JsonPath(std::string_view path)
+			: expression(path), steps(Compiler(path).compile())
+		{}
+
+		std::vector<const JsonElement*> JsonPath::evaluate(const JsonElement& root) const
+		{
+			std::vector<const JsonElement*> results;
+			evaluate(root, results);
+			return results;
+		}
+
+		void JsonPath::evaluate(const JsonElement& root, std::vector<const JsonElement*>& results) const
+		{
+			walk(root, 0, results, std::numeric_limits<size_t>::max());
+		}
+
+		const JsonElement* JsonPath::first(const JsonElement& root) const
+		{
+			std::vector<const JsonElement*> results;
+			walk(root, 0, results, 1);
+			return results.empty() ? nullptr : results.front();
+		}
+
+		const std::string& JsonPath::toString() const
+		{
+			return expression;
+		}
+
+
+		bool JsonPath::walk(const JsonElement& node, size_t step, std::vector<const JsonElement*>& results, size_t limit) const
+		{
+			if (step == steps.size())
+			{
+				results.push_back(&node);
+				return results.size() >= limit;
+			}
+
+			const Step& current = steps[step];
+			switch (current.type)
+			{
+				case StepType::Key:
+				{
+					if (!node.isObject()) return false;
+					const JsonElement* child = node.asObject().tryGet(current.key);
+					return child != nullptr && walk(*child, step + 1, results, limit);
+				}
+				case StepType::Index:
+				{
+					if (!node.isArray()) return false;
+					const JsonArray& array = node.asArray();
+					const int index = current.index < 0 ? current.index + static_cast<int>(array.size()) : current.index;
+					return index >= 0 && index < static_cast<int>(array.size()) && walk(array[index], step + 1, results, limit);
+				}
+				case StepType::Wildcard:
+					return forEachChild(node, [&](const JsonElement& child) {
+						return walk(child, step + 1, results, limit);
+					});
+				case StepType::Filter:
+					return forEachChild(node, [&](const JsonElement& child) {
+						return matches(current, child) && walk(child, step + 1, results, limit);
+					});
+				default:
+					return descend(node, step, results, limit);
+			}
+		}
+
+		bool JsonPath::descend(const JsonElement& node, size_t step, std::vector<const JsonElement*>& results, size_t limit) const
+		{
+			const Step& current = steps[step];
+			if (current.type == StepType::DescendantKey && node.isObject())
+			{
+				const JsonElement* child = node.asObject().tryGet(current.key);
+				if (child != nullptr && walk(*child, step + 1, results, limit)) return true;
+			}
+
+			return forEachChild(node, [&](const JsonElement& child) {
+				if (current.type == StepType::DescendantWildcard && walk(child, step + 1, results, limit)) return true;
+				return descend(child, step, results, limit);
+			});
+		}
+
+		bool JsonPath::matches(const Step& filter, const JsonElement& element)
+		{
+			const JsonElement* value = &element;
+			for (const Step& step : filter.filterPath)
+			{
+				if (step.type == StepType::Key)
+				{
+					value = value->isObject() ? value->asObject().tryGet(step.key) : nullptr;
+				}
+				else if (value->isArray())
+				{
+					const int size = static_cast<int>(value->asArray().size());
+					const int index = step.index < 0 ? step.index + size : step.index;
+					value = index >= 0 && index < size ? &value->asArray()[index] : nullptr;
+				}
+				else
+				{
+					value = nullptr;
+				}
+
+				if (value == nullptr) return false;
+			}
+
+			const JsonElement& literal = filter.filterValue;
+			switch (filter.filterOperator)
+			{
+				case Operator::Exists:
+					return true;
+				case Operator::Equal:
+					return isNumber(*value) && isNumber(literal) ? toDouble(*value) == toDouble(literal) : *value == literal;
+				case Operator::NotEqual:
+					return isNumber(*value) && isNumber(literal) ? toDouble(*value) != toDouble(literal) : *value != literal;
+				default:
+					break;
+			}
+
+			int order;
+			if (isNumber(*value) && isNumber(literal))
+			{
+				const double x = toDouble(*value);
+				const double y = toDouble(literal);
+				if (x != x || y != y) return false;
+				order = x < y ? -1 : (x > y ? 1 : 0);
+			}
+			else if (value->isString() && literal.isString())
+			{
+				order = value->asString().compare(literal.asString());
+			}
+			else
+			{
+				return false;
+			}
+
+			switch (filter.filterOperator)
+			{
+				case Operator::Less: return order < 0;
+				case Operator::LessEqual: return order <= 0;
+				case Operator::Greater: return order > 0;
+				default: return order >= 0;
+			}
+		}
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "json/JsonPointer.h"
+
+#include "exception/json/JsonPathException.h"
+
+#include <algorithm>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/** @brief Returns the token as an array index, or -1 if it is not a canonical non-negative integer. */
+		static int toIndex(std::string_view token)
+		{
+			if (token.empty() || token.size() > 9 || (token.size() > 1 && token[0] == '0'))
+			{
+				return -1;
+			}
+
+			int index = 0;
+			for (char c : token)
+			{
+				if (c < '0' || c > '9') return -1;
+				index = index * 10 + (c - '0');
+			}
+			return index;
+		}
+
+		static JsonPointer::Token makeToken(std::string name)
+		{
+			const int index = toIndex(name);
+			return JsonPointer::Token{ std::move(name), index };
+		}
+
+		JsonPointer::JsonPointer(std::string_view pointer)
+		{
+			if (pointer.empty())
+			{
+				return;
+			}
+			if (pointer[0] != '/')
+			{
+				throw r_utils::exception::JsonPathException("Invalid JSON pointer: " + std::string(pointer));
+			}
+
+			std::string token;
+			for (size_t i = 1; i <= pointer.size(); ++i)
+			{
+				if (i == pointer.size() || pointer[i] == '/')
+				{
+					tokens.push_back(makeToken(std::move(token)));
+					token.clear();
+					continue;
+				}
+
+				if (pointer[i] != '~')
+				{
+					token += pointer[i];
+					continue;
+				}
+
+				if (i + 1 == pointer.size() || (pointer[i + 1] != '0' && pointer[i + 1] != '1'))
+				{
+					throw r_utils::exception::JsonPathException("Invalid JSON pointer: " + std::string(pointer));
+				}
+				token += pointer[++i] == '0' ? '~' : '/';
+			}
+		}
+
+		const JsonElement* JsonPointer::evaluate(const JsonElement& root) const
+		{
+			const JsonElement* current = &root;
+			for (const Token& token : tokens)
+			{
+				if (current->isObject())
+				{
+					current = current->asObject().tryGet(token.name);
+				}
+				else if (current->isArray() && token.index >= 0 && token.index < static_cast<int>(current->asArray().size()))
+				{
+					current = &current->asArray()[token.index];
+				}
+				else
+				{
+					current = nullptr;
+				}
+
+				if (current == nullptr) return nullptr;
+			}
+			return current;
+		}
+
+		JsonElement* JsonPointer::evaluate(JsonElement& root) const
+		{
+			// Check first so that a missing path does not detach shared containers.
+			if (evaluate(static_cast<const JsonElement&>(root)) == nullptr)
+			{
+				return nullptr;
+			}
+
+			// The mutable accessors detach every container on the path, so the result can be modified.
+			JsonElement* current = &root;
+			for (const Token& token : tokens)
+			{
+				current = current->isObject() ? current->asObject().tryGet(token.name) : &current->asArray()[token.index];
+			}
+			return current;
+		}
+
+		bool JsonPointer::isRoot() const
+		{
+			return tokens.empty();
+		}
+
+		JsonPointer JsonPointer::parent() const
+		{
+			JsonPointer result(*this);
+			if (!result.tokens.empty())
+			{
+				result.tokens.pop_back();
+			}
+			return result;
+		}
+
+		JsonPointer JsonPointer::append(std::string_view token) const
+		{
+			JsonPointer result(*this);
+			result.tokens.push_back(makeToken(std::string(token)));
+			return result;
+		}
+
+		const std::vector<JsonPointer::Token>& JsonPointer::getTokens() const
+		{
+			return tokens;
+		}
+
+		std::string JsonPointer::toString() const
+		{
+			std::string result;
+			for (const Token& token : tokens)
+			{
+				result += '/';
+				result += escape(token.name);
+			}
+			return result;
+		}
+
+		std::string JsonPointer::escape(std::string_view token)
+		{
+			std::string result;
+			result.reserve(token.size());
+			for (char c : token)
+			{
+				if (c == '~') result += "~0";
+				else if (c == '/') result += "~1";
+				else result += c;
+			}
+			return result;
+		}
+
+
+		bool operator==(const r_utils::json::JsonPointer& x, const r_utils::json::JsonPointer& y)
+		{
+			const auto& a = x.getTokens();
+			const auto& b = y.getTokens();
+			return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const JsonPointer::Token& l, const JsonPointer::Token& r) {
+				return l.name == r.name;
+			});
+		}
+	} // json
+} // r_utils
\ No newline at end of file
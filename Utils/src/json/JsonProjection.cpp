@@ -0,0 +1,143 @@
+#include "json/JsonProjection.h"
+#include "json/JsonPointer.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		JsonProjection::JsonProjection()
+			: nodes(1)
+		{}
+
+		JsonProjection::JsonProjection(std::initializer_list<std::string_view> paths)
+			: nodes(1)
+		{
+			for (std::string_view path : paths)
+			{
+				add(path);
+			}
+		}
+
+		JsonProjection& JsonProjection::add(std::string_view path)
+		{
+			insert(ROOT, JsonPointer(path), 0);
+			return *this;
+		}
+
+		void JsonProjection::insert(uint32_t node, const JsonPointer& pointer, size_t position)
+		{
+			if (position == pointer.getTokens().size())
+			{
+				nodes[node].selected = true;
+				return;
+			}
+
+			const JsonPointer::Token& token = pointer.getTokens()[position];
+			if (token.name == "*")
+			{
+				if (nodes[node].wildcard == NONE)
+				{
+					const uint32_t wildcard = static_cast<uint32_t>(nodes.size());
+					nodes.emplace_back();
+					nodes[node].wildcard = wildcard;
+				}
+				insert(nodes[node].wildcard, pointer, position + 1);
+
+				// Numbered elements select the union of their own paths and the "*" paths.
+				for (size_t i = 0; i < nodes[node].elements.size(); ++i)
+				{
+					insert(nodes[node].elements[i].second, pointer, position + 1);
+				}
+				return;
+			}
+
+			uint32_t member = child(node, std::string_view(token.name));
+			if (member == NONE)
+			{
+				member = static_cast<uint32_t>(nodes.size());
+				nodes.emplace_back();
+				nodes[node].children.emplace_back(token.name, member);
+			}
+			insert(member, pointer, position + 1);
+
+			if (token.index >= 0)
+			{
+				uint32_t element = NONE;
+				for (const auto& [index, id] : nodes[node].elements)
+				{
+					if (index == static_cast<size_t>(token.index)) element = id;
+				}
+				if (element == NONE)
+				{
+					if (nodes[node].wildcard != NONE)
+					{
+						element = copy(nodes[node].wildcard);
+					}
+					else
+					{
+						element = static_cast<uint32_t>(nodes.size());
+						nodes.emplace_back();
+					}
+					nodes[node].elements.emplace_back(static_cast<size_t>(token.index), element);
+				}
+				insert(element, pointer, position + 1);
+			}
+		}
+
+		uint32_t JsonProjection::copy(uint32_t node)
+		{
+			const uint32_t id = static_cast<uint32_t>(nodes.size());
+			nodes.push_back(nodes[node]);
+			// copy() grows nodes, so no reference into it is held across the recursion.
+			for (size_t i = 0; i < nodes[id].children.size(); ++i)
+			{
+				const uint32_t child = copy(nodes[id].children[i].second);
+				nodes[id].children[i].second = child;
+			}
+			for (size_t i = 0; i < nodes[id].elements.size(); ++i)
+			{
+				const uint32_t child = copy(nodes[id].elements[i].second);
+				nodes[id].elements[i].second = child;
+			}
+			if (nodes[id].wildcard != NONE)
+			{
+				const uint32_t wildcard = copy(nodes[id].wildcard);
+				nodes[id].wildcard = wildcard;
+			}
+			return id;
+		}
+
+		bool JsonProjection::empty() const
+		{
+			return nodes.size() == 1 && !nodes[ROOT].selected;
+		}
+
+		uint32_t JsonProjection::child(uint32_t node, std::string_view key) const
+		{
+			for (const auto& [name, id] : nodes[node].children)
+			{
+				if (name == key) return id;
+			}
+			return NONE;
+		}
+
+		uint32_t JsonProjection::child(uint32_t node, size_t index) const
+		{
+			for (const auto& [position, id] : nodes[node].elements)
+			{
+				if (position == index) return id;
+			}
+			return nodes[node].wildcard;
+		}
+
+		bool JsonProjection::hasWildcard(uint32_t node) const
+		{
+			return nodes[node].wildcard != NONE;
+		}
+
+		bool JsonProjection::isSelected(uint32_t node) const
+		{
+			return nodes[node].selected;
+		}
+	} // json
+} // r_utils
\ No newline at end of file
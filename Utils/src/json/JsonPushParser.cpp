@@ -0,0 +1,273 @@
+#include "json/JsonPushParser.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+
+		JsonPushParser::JsonPushParser(IJsonHandler& handler)
+			: handler(&handler)
+		{}
+
+		JsonPushParser::JsonPushParser(std::function<void(JsonElement)> onElement)
+			: builder(std::make_unique<JsonElementBuilder>()), onElement(std::move(onElement))
+		{
+			this->handler = builder.get();
+		}
+
+
+		static bool isWhitespace(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+		}
+
+		static bool isDelimiter(char c)
+		{
+			switch (c)
+			{
+				case ' ': case '\t': case '\n': case '\r':
+				case '{': case '}': case '[': case ']': case ':': case ',':
+					return true;
+				default:
+					return false;
+			}
+		}
+
+		void JsonPushParser::feed(std::string_view data)
+		{
+			feed(data.data(), data.size());
+		}
+
+		void JsonPushParser::feed(const char* data, size_t size)
+		{
+			size_t i = 0;
+			while (i < size)
+			{
+				switch (state)
+				{
+					case State::String:
+						i = string(data, i, size);
+						break;
+
+					case State::Number:
+					case State::Literal:
+					{
+						size_t start = i;
+						while (i < size && !isDelimiter(data[i])) i++;
+						token.append(data + start, i - start);
+						if (i < size) finishToken();
+						break;
+					}
+
+					default:
+						structural(data[i++]);
+						break;
+				}
+			}
+		}
+
+		void JsonPushParser::finish()
+		{
+			if (state == State::Number || state == State::Literal)
+			{
+				finishToken();
+			}
+
+			if (state != State::Value || !stack.empty())
+			{
+				throw r_utils::exception::JsonParserException("Unexpected end of input");
+			}
+		}
+
+
+		void JsonPushParser::structural(char c)
+		{
+			if (isWhitespace(c))
+			{
+				return;
+			}
+
+			switch (state)
+			{
+				case State::FirstKey:
+					if (c == '}')
+					{
+						stack.pop_back();
+						handler->onEndObject();
+						endValue();
+						return;
+					}
+					[[fallthrough]];
+				case State::Key:
+					if (c != '"' && c != '\'')
+					{
+						throw r_utils::exception::JsonParserException("Expected string, got '" + std::string(1, c) + "'");
+					}
+					token.clear();
+					quote = c;
+					isKey = true;
+					state = State::String;
+					return;
+
+				case State::Colon:
+					if (c != ':')
+					{
+						throw r_utils::exception::JsonParserException("Expected ':' after key");
+					}
+					state = State::Value;
+					return;
+
+				case State::AfterValue:
+					if (c == ',')
+					{
+						state = stack.back() == '{' ? State::Key : State::Value;
+					}
+					else if (c == '}' && stack.back() == '{')
+					{
+						stack.pop_back();
+						handler->onEndObject();
+						endValue();
+					}
+					else if (c == ']' && stack.back() == '[')
+					{
+						stack.pop_back();
+						handler->onEndArray();
+						endValue();
+					}
+					else
+					{
+						throw r_utils::exception::JsonParserException(std::string("Expected ',' or '") + (stack.back() == '{' ? '}' : ']') + "', got '" + std::string(1, c) + "'");
+					}
+					return;
+
+				case State::FirstValue:
+					if (c == ']')
+					{
+						stack.pop_back();
+						handler->onEndArray();
+						endValue();
+						return;
+					}
+					[[fallthrough]];
+				default:
+					break;
+			}
+
+			token.clear();
+			if (c == '{')
+			{
+				stack.push_back('{');
+				handler->onStartObject();
+				state = State::FirstKey;
+			}
+			else if (c == '[')
+			{
+				stack.push_back('[');
+				handler->onStartArray();
+				state = State::FirstValue;
+			}
+			else if (c == '"' || c == '\'')
+			{
+				quote = c;
+				isKey = false;
+				state = State::String;
+			}
+			else if ((c >= '0' && c <= '9') || c == '-' || c == '+')
+			{
+				token += c;
+				state = State::Number;
+			}
+			else if (c == 't' || c == 'f' || c == 'n')
+			{
+				token += c;
+				state = State::Literal;
+			}
+			else
+			{
+				throw r_utils::exception::JsonParserException("Unexpected token: " + std::string(1, c));
+			}
+		}
+
+		size_t JsonPushParser::string(const char* data, size_t i, size_t size)
+		{
+			// An escape can be split across chunks, so its characters are collected until it is complete.
+			while (escape)
+			{
+				if (i >= size) return i;
+
+				escapeSequence += data[i++];
+				if (JsonParser::unescape(escapeSequence, token) != 0)
+				{
+					escapeSequence.clear();
+					escape = false;
+				}
+			}
+
+			size_t runStart = i;
+			while (i < size)
+			{
+				char c = data[i];
+				if (c == quote)
+				{
+					token.append(data + runStart, i - runStart);
+					if (isKey)
+					{
+						handler->onKey(token);
+						state = State::Colon;
+					}
+					else
+					{
+						handler->onString(token);
+						endValue();
+					}
+					return i + 1;
+				}
+				if (c == '\\')
+				{
+					token.append(data + runStart, i - runStart);
+					escape = true;
+					return i + 1;
+				}
+				i++;
+			}
+
+			token.append(data + runStart, i - runStart);
+			return i;
+		}
+
+		void JsonPushParser::finishToken()
+		{
+			if (state == State::Number)
+			{
+				JsonParser::emitNumber(token, *handler);
+			}
+			else if (token == "true" || token == "false")
+			{
+				handler->onBoolean(token == "true");
+			}
+			else if (token == "null")
+			{
+				handler->onNull();
+			}
+			else
+			{
+				throw r_utils::exception::JsonParserException("Invalid literal: " + token);
+			}
+
+			endValue();
+		}
+
+		void JsonPushParser::endValue()
+		{
+			state = stack.empty() ? State::Value : State::AfterValue;
+
+			if (stack.empty() && builder && builder->hasResult())
+			{
+				onElement(builder->takeResult());
+			}
+		}
+	} // json
+} // r_utils
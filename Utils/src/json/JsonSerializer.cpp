@@ -0,0 +1,266 @@
+#include "json/JsonSerializer.h"
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define R_UTILS_JSON_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace r_utils
+{
+	namespace json
+	{
+		JsonSerializer::JsonSerializer(bool prettyPrint)
+			: prettyPrint(prettyPrint) {}
+
+		JsonSerializer& JsonSerializer::write(const JsonElement& element, int indentLevel)
+		{
+			writeValue(element, indentLevel);
+			return *this;
+		}
+
+		JsonSerializer& JsonSerializer::write(const JsonObject& object, int indentLevel)
+		{
+			writeObject(object, indentLevel);
+			return *this;
+		}
+
+		JsonSerializer& JsonSerializer::write(const JsonArray& array, int indentLevel)
+		{
+			writeArray(array, indentLevel);
+			return *this;
+		}
+
+		const std::string& JsonSerializer::getBuffer() const
+		{
+			return buffer;
+		}
+
+		std::string JsonSerializer::take()
+		{
+			return std::move(buffer);
+		}
+
+		void JsonSerializer::clear()
+		{
+			buffer.clear();
+		}
+
+		std::string JsonSerializer::serialize(const JsonElement& element, bool prettyPrint)
+		{
+			JsonSerializer serializer(prettyPrint);
+			serializer.write(element);
+			return serializer.take();
+		}
+
+
+		static bool needsEscape(char c)
+		{
+			return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+		}
+
+		/**
+		 * @brief Returns the offset of the first character in [i, size) that needs escaping, or size.
+		 */
+		static size_t findEscape(const char* data, size_t i, size_t size)
+		{
+#if defined(R_UTILS_JSON_SSE2)
+			const __m128i quote = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			const __m128i control = _mm_set1_epi8(0x1F);
+
+			for (; i + 16 <= size; i += 16)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				// Unsigned chunk <= 0x1F is equivalent to min(chunk, 0x1F) == chunk.
+				const __m128i special = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+					_mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+
+				const int mask = _mm_movemask_epi8(special);
+				if (mask != 0)
+				{
+					return i + std::countr_zero(static_cast<unsigned>(mask));
+				}
+			}
+#endif
+			while (i < size && !needsEscape(data[i])) i++;
+			return i;
+		}
+
+		void JsonSerializer::appendString(std::string& out, std::string_view value)
+		{
+			static constexpr char HEX[] = "0123456789abcdef";
+
+			out += '"';
+
+			size_t i = 0;
+			while (i < value.size())
+			{
+				const size_t special = findEscape(value.data(), i, value.size());
+				out.append(value.data() + i, special - i);
+				if (special == value.size())
+				{
+					break;
+				}
+
+				const char c = value[special];
+				switch (c)
+				{
+					case '"': out += "\\\""; break;
+					case '\\': out += "\\\\"; break;
+					case '\n': out += "\\n"; break;
+					case '\t': out += "\\t"; break;
+					case '\r': out += "\\r"; break;
+					case '\b': out += "\\b"; break;
+					case '\f': out += "\\f"; break;
+					default:
+						out += "\\u00";
+						out += HEX[(c >> 4) & 0xF];
+						out += HEX[c & 0xF];
+						break;
+				}
+				i = special + 1;
+			}
+
+			out += '"';
+		}
+
+		void JsonSerializer::appendNumber(std::string& out, int value)
+		{
+			char digits[16];
+			auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+			out.append(digits, end);
+		}
+
+		void JsonSerializer::appendNumber(std::string& out, long long value)
+		{
+			char digits[24];
+			auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+			out.append(digits, end);
+		}
+
+		void JsonSerializer::appendNumber(std::string& out, unsigned long long value)
+		{
+			char digits[24];
+			auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+			out.append(digits, end);
+		}
+
+		void JsonSerializer::appendNumber(std::string& out, double value)
+		{
+			if (!std::isfinite(value))
+			{
+				out += "null";
+				return;
+			}
+
+			char digits[32];
+			auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+			out.append(digits, end);
+
+			if (std::string_view(digits, end - digits).find_first_of(".e") == std::string_view::npos)
+			{
+				out += ".0";
+			}
+		}
+
+
+		void JsonSerializer::newline(int level)
+		{
+			buffer += '\n';
+			buffer.append(level, '\t');
+		}
+
+		void JsonSerializer::writeValue(const JsonElement& element, int level)
+		{
+			switch (element.getType())
+			{
+				case JsonType::String: appendString(buffer, element.asString()); break;
+				case JsonType::Int: appendNumber(buffer, element.asInt()); break;
+				case JsonType::Double: appendNumber(buffer, element.asDouble()); break;
+				case JsonType::Boolean: buffer += element.asBoolean() ? "true" : "false"; break;
+				case JsonType::Array: writeArray(element.asArray(), level); break;
+				case JsonType::Object: writeObject(element.asObject(), level); break;
+				default: buffer += "null"; break;
+			}
+		}
+
+		void JsonSerializer::writeObject(const JsonObject& object, int level)
+		{
+			buffer += '{';
+
+			bool first = true;
+			for (const auto& [key, value] : object.getValues())
+			{
+				if (!first)
+				{
+					buffer += ',';
+				}
+				first = false;
+
+				if (prettyPrint)
+				{
+					newline(level + 1);
+				}
+				appendString(buffer, key);
+				buffer += prettyPrint ? ": " : ":";
+				writeValue(value, level + 1);
+			}
+
+			if (prettyPrint && !first)
+			{
+				newline(level);
+			}
+			buffer += '}';
+		}
+
+		void JsonSerializer::writeArray(const JsonArray& array, int level)
+		{
+			// Arrays of scalars stay on one line when pretty-printing.
+			bool multiline = false;
+			if (prettyPrint)
+			{
+				for (const auto& element : array.getValues())
+				{
+					if (element.isArray() || element.isObject())
+					{
+						multiline = true;
+						break;
+					}
+				}
+			}
+
+			buffer += '[';
+
+			bool first = true;
+			for (const auto& element : array.getValues())
+			{
+				if (!first)
+				{
+					buffer += ',';
+					if (prettyPrint && !multiline)
+					{
+						buffer += ' ';
+					}
+				}
+				first = false;
+
+				if (multiline)
+				{
+					newline(level + 1);
+				}
+				writeValue(element, level + 1);
+			}
+
+			if (multiline)
+			{
+				newline(level);
+			}
+			buffer += ']';
+		}
+	} // json
+} // r_utils
@@ -0,0 +1,287 @@
+#include "json/JsonSnapshot.h"
+
+#include "exception/file/FileException.h"
+#include "exception/json/JsonParserException.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @brief The fixed header at the start of every snapshot file.
+		 */
+		struct JsonSnapshotHeader
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t byteOrder;
+			uint64_t wordCount;
+			uint64_t stringsSize;
+			uint64_t wordsOffset;
+			uint64_t stringsOffset;
+		};
+
+		static_assert(sizeof(JsonSnapshotHeader) % sizeof(uint64_t) == 0, "Tape words must stay 8-byte aligned");
+
+		static constexpr char SNAPSHOT_MAGIC[8] = { 'R', 'U', 'J', 'S', 'N', 'A', 'P', '\0' };
+		static constexpr uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+		[[noreturn]] static void invalidSnapshot(const r_utils::io::File& file, const std::string& reason)
+		{
+			throw r_utils::exception::JsonParserException("Invalid JSON snapshot \"" + file.getFilePath() + "\": " + reason);
+		}
+
+		/**
+		 * @brief Checks that the root value spans exactly all words, looking only at its first and last word.
+		 */
+		static bool isCompleteValue(const uint64_t* words, uint64_t count)
+		{
+			const JsonTapeTag tag = static_cast<JsonTapeTag>(words[0] >> 56);
+			switch (tag)
+			{
+				case JsonTapeTag::Null:
+				case JsonTapeTag::True:
+				case JsonTapeTag::False:
+				case JsonTapeTag::String:
+					return count == 1;
+				case JsonTapeTag::Int:
+				case JsonTapeTag::Double:
+					return count == 2;
+				case JsonTapeTag::StartArray:
+				case JsonTapeTag::StartObject:
+				{
+					const uint64_t distance = words[0] & 0xFFFFFFFF;
+					const JsonTapeTag endTag = tag == JsonTapeTag::StartArray ? JsonTapeTag::EndArray : JsonTapeTag::EndObject;
+					return distance + 1 == count && static_cast<JsonTapeTag>(words[distance] >> 56) == endTag;
+				}
+				default:
+					return false;
+			}
+		}
+
+		/**
+		 * @brief Checks every word of a tape once so that views never read outside of it.
+		 *
+		 * Verifies the tags, that every string lies inside the string buffer, that numbers
+		 * have their value word, that every container's start and end words point at each
+		 * other and record its element count, that object members are string keys followed
+		 * by a value, and that the root value spans exactly all words.
+		 *
+		 * @return nullptr if the tape is well-formed, otherwise what is wrong with it.
+		 */
+		static const char* findTapeError(const uint64_t* words, uint64_t wordCount, const char* strings, uint64_t stringsSize)
+		{
+			constexpr uint64_t PAYLOAD_MASK = (uint64_t(1) << 56) - 1;
+
+			/** An open container: its start word, the values seen so far and whether a key awaits its value. */
+			struct Container
+			{
+				uint64_t start;
+				uint64_t count;
+				bool isObject;
+				bool afterKey;
+			};
+			std::vector<Container> open;
+
+			uint64_t i = 0;
+			do
+			{
+				if (i >= wordCount)
+				{
+					return "tape ends inside a container";
+				}
+
+				const JsonTapeTag tag = static_cast<JsonTapeTag>(words[i] >> 56);
+				const uint64_t payload = words[i] & PAYLOAD_MASK;
+				const bool isEnd = tag == JsonTapeTag::EndArray || tag == JsonTapeTag::EndObject;
+
+				if (!open.empty() && !isEnd)
+				{
+					Container& parent = open.back();
+					if (!parent.isObject)
+					{
+						parent.count++;
+					}
+					else if (!parent.afterKey)
+					{
+						if (tag != JsonTapeTag::String) return "object key is not a string";
+						parent.afterKey = true;
+					}
+					else
+					{
+						parent.count++;
+						parent.afterKey = false;
+					}
+				}
+
+				switch (tag)
+				{
+					case JsonTapeTag::Null:
+					case JsonTapeTag::True:
+					case JsonTapeTag::False:
+						i++;
+						break;
+					case JsonTapeTag::Int:
+					case JsonTapeTag::Double:
+						if (wordCount - i < 2) return "number without a value word";
+						i += 2;
+						break;
+					case JsonTapeTag::String:
+					{
+						uint32_t length;
+						if (stringsSize < sizeof(length) || payload > stringsSize - sizeof(length)) return "string offset exceeds the string buffer";
+						std::memcpy(&length, strings + payload, sizeof(length));
+						if (length > stringsSize - sizeof(length) - payload) return "string length exceeds the string buffer";
+						i++;
+						break;
+					}
+					case JsonTapeTag::StartArray:
+					case JsonTapeTag::StartObject:
+					{
+						const uint64_t distance = payload & 0xFFFFFFFF;
+						if (distance == 0 || distance >= wordCount - i) return "container end exceeds the tape";
+						open.push_back(Container{ i, 0, tag == JsonTapeTag::StartObject, false });
+						i++;
+						break;
+					}
+					case JsonTapeTag::EndArray:
+					case JsonTapeTag::EndObject:
+					{
+						if (open.empty()) return "unmatched container end";
+						const Container container = open.back();
+						open.pop_back();
+
+						const uint64_t startWord = words[container.start];
+						const JsonTapeTag startTag = tag == JsonTapeTag::EndArray ? JsonTapeTag::StartArray : JsonTapeTag::StartObject;
+						const uint64_t distance = i - container.start;
+						if (static_cast<JsonTapeTag>(startWord >> 56) != startTag || (startWord & 0xFFFFFFFF) != distance || payload != distance)
+						{
+							return "container start and end words do not match";
+						}
+						if (container.afterKey) return "object key without a value";
+						if ((startWord & PAYLOAD_MASK) >> 32 != std::min<uint64_t>(container.count, 0xFFFFFF))
+						{
+							return "container element count does not match";
+						}
+						i++;
+						break;
+					}
+					default:
+						return "unknown tag";
+				}
+			} while (!open.empty());
+
+			return i == wordCount ? nullptr : "words after the root value";
+		}
+
+
+		void JsonSnapshot::write(const JsonTape& tape, const r_utils::io::File& file)
+		{
+			const std::vector<uint64_t>& words = tape.getWords();
+			const std::string& strings = tape.getStrings();
+
+			JsonSnapshotHeader header{};
+			std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+			header.version = VERSION;
+			header.byteOrder = SNAPSHOT_BYTE_ORDER;
+			header.wordCount = words.size();
+			header.stringsSize = strings.size();
+			header.wordsOffset = sizeof(JsonSnapshotHeader);
+			header.stringsOffset = header.wordsOffset + words.size() * sizeof(uint64_t);
+
+			std::ofstream out(file.getFilePath(), std::ios::binary | std::ios::trunc);
+			if (!out.is_open())
+			{
+				throw r_utils::exception::FileException("Failed to open file for writing: \"" + file.getFilePath() + "\"");
+			}
+
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(uint64_t)));
+			out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+			if (!out.flush())
+			{
+				throw r_utils::exception::FileException("Error writing to file: " + file.getFilePath());
+			}
+		}
+
+		void JsonSnapshot::write(const JsonElement& element, const r_utils::io::File& file)
+		{
+			write(JsonTape::fromElement(element), file);
+		}
+
+		JsonSnapshot JsonSnapshot::open(const r_utils::io::File& file)
+		{
+			r_utils::io::MappedFile mapping(file, r_utils::io::MappedFile::Access::Random);
+			const size_t size = mapping.getSize();
+			if (size < sizeof(JsonSnapshotHeader))
+			{
+				invalidSnapshot(file, "file is too small");
+			}
+
+			JsonSnapshotHeader header;
+			std::memcpy(&header, mapping.getData(), sizeof(header));
+			if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0)
+			{
+				invalidSnapshot(file, "not a snapshot");
+			}
+			if (header.version != VERSION)
+			{
+				invalidSnapshot(file, "unsupported version " + std::to_string(header.version));
+			}
+			if (header.byteOrder != SNAPSHOT_BYTE_ORDER)
+			{
+				invalidSnapshot(file, "written with a different byte order");
+			}
+			if (header.wordCount == 0 || header.wordsOffset % sizeof(uint64_t) != 0 || header.wordsOffset > size
+				|| header.wordCount > (size - header.wordsOffset) / sizeof(uint64_t)
+				|| header.stringsOffset > size || header.stringsSize > size - header.stringsOffset)
+			{
+				invalidSnapshot(file, "sections exceed the file");
+			}
+
+			JsonSnapshot snapshot(std::move(mapping));
+			snapshot.words = reinterpret_cast<const uint64_t*>(snapshot.mapping.getData() + header.wordsOffset);
+			snapshot.wordCount = header.wordCount;
+			snapshot.strings = snapshot.mapping.getData() + header.stringsOffset;
+			snapshot.stringsSize = header.stringsSize;
+
+			if (!isCompleteValue(snapshot.words, snapshot.wordCount))
+			{
+				invalidSnapshot(file, "malformed root value");
+			}
+			return snapshot;
+		}
+
+		void JsonSnapshot::validate() const
+		{
+			if (const char* error = findTapeError(words, wordCount, strings, stringsSize))
+			{
+				throw r_utils::exception::JsonParserException(std::string("Invalid JSON snapshot: ") + error);
+			}
+		}
+
+		JsonSnapshot::JsonSnapshot(r_utils::io::MappedFile mapping)
+			: mapping(std::move(mapping))
+		{}
+
+		JsonValueView JsonSnapshot::getRoot() const
+		{
+			return JsonValueView(words, strings);
+		}
+
+		size_t JsonSnapshot::getWordCount() const
+		{
+			return wordCount;
+		}
+
+		size_t JsonSnapshot::getStringsSize() const
+		{
+			return stringsSize;
+		}
+	} // json
+} // r_utils
\ No newline at end of file
@@ -0,0 +1,461 @@
+#include "json/JsonStructuralIndex.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define R_UTILS_JSON_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(R_UTILS_JSON_X86) && (defined(__GNUC__) || defined(__clang__))
+#define R_UTILS_JSON_TARGET(features) __attribute__((target(features)))
+#else
+#define R_UTILS_JSON_TARGET(features)
+#endif
+
+namespace r_utils
+{
+	namespace json
+	{
+		static constexpr uint8_t CLASS_OPERATOR = 1;
+		static constexpr uint8_t CLASS_WHITESPACE = 2;
+
+		static constexpr std::array<uint8_t, 256> CHARACTER_CLASSES = [] {
+			std::array<uint8_t, 256> table{};
+			for (unsigned char c : { '{', '}', '[', ']', ':', ',' }) table[c] = CLASS_OPERATOR;
+			for (unsigned char c : { ' ', '\t', '\n', '\r' }) table[c] = CLASS_WHITESPACE;
+			return table;
+		}();
+
+		/**
+		 * @brief Bitmaps for one 64-byte block, one bit per input byte.
+		 */
+		struct BlockMasks
+		{
+			uint64_t quote;
+			uint64_t singleQuote;
+			uint64_t backslash;
+			uint64_t op;
+			uint64_t whitespace;
+		};
+
+		/**
+		 * @brief Growable output buffer for positions, written without per-element bounds checks.
+		 */
+		struct PositionWriter
+		{
+			std::vector<uint32_t>& positions;
+			size_t count = 0;
+
+			void reserveBlock()
+			{
+				if (count + 64 > positions.size())
+				{
+					positions.resize(std::max<size_t>(positions.size() * 2, count + 64));
+				}
+			}
+
+			void push(size_t position)
+			{
+				reserveBlock();
+				positions[count++] = static_cast<uint32_t>(position);
+			}
+
+			void flatten(uint64_t bits, uint32_t base)
+			{
+				uint32_t* out = positions.data() + count;
+				while (bits)
+				{
+					*out++ = base + static_cast<uint32_t>(std::countr_zero(bits));
+					bits &= bits - 1;
+				}
+				count = static_cast<size_t>(out - positions.data());
+			}
+		};
+
+		/**
+		 * @brief Returns the bits of all characters escaped by a preceding, unescaped backslash.
+		 */
+		static uint64_t escapedCharacters(uint64_t backslash, uint64_t& prevEscaped)
+		{
+			if (!backslash)
+			{
+				uint64_t escaped = prevEscaped;
+				prevEscaped = 0;
+				return escaped;
+			}
+
+			constexpr uint64_t oddBits = 0xAAAAAAAAAAAAAAAAULL;
+			uint64_t potentialEscape = backslash & ~prevEscaped;
+			uint64_t maybeEscaped = potentialEscape << 1;
+			uint64_t evenSeriesCodesAndOddBits = (maybeEscaped | oddBits) - potentialEscape;
+			uint64_t escapeAndTerminalCode = evenSeriesCodesAndOddBits ^ oddBits;
+			uint64_t escaped = escapeAndTerminalCode ^ (backslash | prevEscaped);
+			prevEscaped = (escapeAndTerminalCode & backslash) >> 63;
+			return escaped;
+		}
+
+		/**
+		 * @brief Computes the running XOR of all bits, turning quote bits into an in-string mask.
+		 */
+		static uint64_t prefixXor(uint64_t bits)
+		{
+			bits ^= bits << 1;
+			bits ^= bits << 2;
+			bits ^= bits << 4;
+			bits ^= bits << 8;
+			bits ^= bits << 16;
+			bits ^= bits << 32;
+			return bits;
+		}
+
+		/**
+		 * @brief Turns the character masks of one block into structural positions.
+		 * @return False if the block contains a single quote outside of a string.
+		 */
+		static bool indexBlock(const BlockMasks& masks, JsonStructuralIndex::ScanState& state, PositionWriter& writer, uint32_t base)
+		{
+			const JsonStructuralIndex::ScanState before = state;
+
+			uint64_t escaped = escapedCharacters(masks.backslash, state.prevEscaped);
+			uint64_t quote = masks.quote & ~escaped;
+
+			uint64_t inString = prefixXor(quote) ^ state.prevInString;
+			state.prevInString = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+
+			if (masks.singleQuote & ~escaped & ~inString)
+			{
+				state = before;
+				return false;
+			}
+
+			uint64_t scalar = ~(masks.op | masks.whitespace);
+			uint64_t nonQuoteScalar = scalar & ~quote;
+			uint64_t followsScalar = (nonQuoteScalar << 1) | state.prevScalar;
+			state.prevScalar = nonQuoteScalar >> 63;
+
+			uint64_t stringTail = inString ^ quote;
+			uint64_t structurals = (masks.op | (scalar & ~followsScalar)) & ~stringTail;
+
+			writer.flatten(structurals, base);
+			return true;
+		}
+
+#if defined(R_UTILS_JSON_X86)
+		/*
+		 * Operators and whitespace are classified with two nibble lookups. A byte belongs to a
+		 * class if the entries for its low and high nibble share a bit:
+		 *   bit 0: ','   bit 1: ':'   bit 2: '[' ']' '{' '}'   bit 3: ' '   bit 4: '\t' '\n' '\r'
+		 */
+		R_UTILS_JSON_TARGET("sse4.2")
+		static BlockMasks classifySse42(const char* block)
+		{
+			const __m128i lowTable = _mm_setr_epi8(8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 18, 4, 1, 20, 0, 0);
+			const __m128i highTable = _mm_setr_epi8(16, 0, 9, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i lowNibble = _mm_set1_epi8(0x0f);
+			const __m128i zero = _mm_setzero_si128();
+
+			BlockMasks masks{};
+			for (int i = 0; i < 4; ++i)
+			{
+				__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+				__m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), lowNibble);
+				__m128i classes = _mm_and_si128(_mm_shuffle_epi8(lowTable, in), _mm_shuffle_epi8(highTable, high));
+
+				uint64_t op = static_cast<uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(classes, _mm_set1_epi8(0x07)), zero)));
+				uint64_t whitespace = static_cast<uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(classes, _mm_set1_epi8(0x18)), zero)));
+				uint64_t quote = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('"'))));
+				uint64_t singleQuote = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('\''))));
+				uint64_t backslash = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('\\'))));
+
+				masks.op |= op << (16 * i);
+				masks.whitespace |= whitespace << (16 * i);
+				masks.quote |= quote << (16 * i);
+				masks.singleQuote |= singleQuote << (16 * i);
+				masks.backslash |= backslash << (16 * i);
+			}
+			return masks;
+		}
+
+		R_UTILS_JSON_TARGET("avx2")
+		static BlockMasks classifyAvx2(const char* block)
+		{
+			const __m256i lowTable = _mm256_setr_epi8(
+				8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 18, 4, 1, 20, 0, 0,
+				8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 18, 4, 1, 20, 0, 0);
+			const __m256i highTable = _mm256_setr_epi8(
+				16, 0, 9, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+				16, 0, 9, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+			const __m256i zero = _mm256_setzero_si256();
+
+			BlockMasks masks{};
+			for (int i = 0; i < 2; ++i)
+			{
+				__m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+				__m256i high = _mm256_and_si256(_mm256_srli_epi16(in, 4), lowNibble);
+				__m256i classes = _mm256_and_si256(_mm256_shuffle_epi8(lowTable, in), _mm256_shuffle_epi8(highTable, high));
+
+				uint64_t op = static_cast<uint32_t>(~_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(classes, _mm256_set1_epi8(0x07)), zero)));
+				uint64_t whitespace = static_cast<uint32_t>(~_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(classes, _mm256_set1_epi8(0x18)), zero)));
+				uint64_t quote = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('"'))));
+				uint64_t singleQuote = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('\''))));
+				uint64_t backslash = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('\\'))));
+
+				masks.op |= op << (32 * i);
+				masks.whitespace |= whitespace << (32 * i);
+				masks.quote |= quote << (32 * i);
+				masks.singleQuote |= singleQuote << (32 * i);
+				masks.backslash |= backslash << (32 * i);
+			}
+			return masks;
+		}
+#endif
+
+		/**
+		 * @brief Runs a 64-byte classifier over [begin, end) of the input.
+		 * @return The offset at which indexing stopped; less than end if the scalar builder has to take over.
+		 */
+		template <typename Classifier>
+		static size_t indexVectorized(std::string_view input, size_t begin, size_t end, JsonStructuralIndex::ScanState& state, PositionWriter& writer, Classifier classify)
+		{
+			size_t offset = begin;
+			for (; offset + 64 <= end; offset += 64)
+			{
+				writer.reserveBlock();
+				if (!indexBlock(classify(input.data() + offset), state, writer, static_cast<uint32_t>(offset)))
+				{
+					return offset;
+				}
+			}
+
+			if (offset < end)
+			{
+				char tail[64];
+				std::memset(tail, ' ', sizeof(tail));
+				std::memcpy(tail, input.data() + offset, end - offset);
+
+				writer.reserveBlock();
+				if (!indexBlock(classify(tail), state, writer, static_cast<uint32_t>(offset)))
+				{
+					return offset;
+				}
+			}
+
+			return end;
+		}
+
+		/**
+		 * @brief Byte-wise builder for [begin, end) of the input. Also understands single-quoted strings.
+		 */
+		static void indexScalar(std::string_view input, size_t begin, size_t end, JsonStructuralIndex::ScanState& state, PositionWriter& writer)
+		{
+			bool inString = state.prevInString != 0;
+			bool escaped = state.prevEscaped != 0;
+			// The vector kernels also mark bytes inside strings as scalar; that bit must not
+			// survive the closing quote when the scalar builder takes over inside a string.
+			bool prevScalar = state.prevScalar != 0 && !inString;
+			char quote = state.quote;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				const char c = input[i];
+				const bool isEscaped = escaped;
+				escaped = (c == '\\' && !isEscaped);
+
+				if (inString)
+				{
+					if (c == quote && !isEscaped) inString = false;
+					continue;
+				}
+
+				const uint8_t cls = CHARACTER_CLASSES[static_cast<unsigned char>(c)];
+				if (cls == CLASS_OPERATOR)
+				{
+					writer.push(i);
+					prevScalar = false;
+				}
+				else if (cls == CLASS_WHITESPACE)
+				{
+					prevScalar = false;
+				}
+				else if ((c == '"' || c == '\'') && !isEscaped)
+				{
+					if (!prevScalar) writer.push(i);
+					inString = true;
+					quote = c;
+					prevScalar = false;
+				}
+				else
+				{
+					if (!prevScalar) writer.push(i);
+					prevScalar = true;
+				}
+			}
+
+			state.prevInString = inString ? ~uint64_t(0) : 0;
+			state.prevEscaped = escaped ? 1 : 0;
+			state.prevScalar = prevScalar ? 1 : 0;
+			state.quote = quote;
+		}
+
+		static JsonStructuralIndex::Implementation detectImplementation()
+		{
+#if defined(R_UTILS_JSON_X86)
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const bool sse42 = (info[2] & (1 << 20)) != 0;
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+
+			bool avx2 = false;
+			if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = (info[1] & (1 << 5)) != 0;
+			}
+#else
+			__builtin_cpu_init();
+			const bool sse42 = __builtin_cpu_supports("sse4.2");
+			const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+			if (avx2) return JsonStructuralIndex::Implementation::AVX2;
+			if (sse42) return JsonStructuralIndex::Implementation::SSE42;
+#endif
+			return JsonStructuralIndex::Implementation::Scalar;
+		}
+
+
+		JsonStructuralIndex::JsonStructuralIndex(std::string_view input)
+			: JsonStructuralIndex(input, 0)
+		{}
+
+		JsonStructuralIndex::JsonStructuralIndex(std::string_view input, size_t windowSize)
+			: JsonStructuralIndex(input, windowSize, getImplementation())
+		{}
+
+		JsonStructuralIndex::JsonStructuralIndex(std::string_view input, size_t windowSize, Implementation implementation)
+			: input(input), windowSize((windowSize + 63) & ~size_t(63)),
+			  implementation(isSupported(implementation) ? implementation : Implementation::Scalar)
+		{
+			if (input.size() > std::numeric_limits<uint32_t>::max())
+			{
+				throw r_utils::exception::JsonParserException("Input exceeds the 4 GiB limit of the structural index");
+			}
+
+			indexWindow();
+		}
+
+		bool JsonStructuralIndex::advance()
+		{
+			if (complete())
+			{
+				return false;
+			}
+
+			indexWindow();
+			return true;
+		}
+
+		bool JsonStructuralIndex::complete() const
+		{
+			return indexed >= input.size();
+		}
+
+		void JsonStructuralIndex::indexWindow()
+		{
+			const size_t begin = indexed;
+			const size_t end = windowSize == 0 ? input.size() : std::min(input.size(), begin + windowSize);
+
+			if (positions.size() < (end - begin) / 4 + 64)
+			{
+				positions.resize((end - begin) / 4 + 64);
+			}
+			PositionWriter writer{ positions };
+
+			size_t offset = begin;
+			if (!state.scalar)
+			{
+				switch (implementation)
+				{
+#if defined(R_UTILS_JSON_X86)
+					case Implementation::AVX2:
+						offset = indexVectorized(input, begin, end, state, writer, classifyAvx2);
+						break;
+					case Implementation::SSE42:
+						offset = indexVectorized(input, begin, end, state, writer, classifySse42);
+						break;
+#endif
+					default:
+						break;
+				}
+				state.scalar = offset < end;
+			}
+
+			if (state.scalar)
+			{
+				indexScalar(input, offset, end, state, writer);
+			}
+
+			positions.resize(writer.count);
+			indexed = end;
+		}
+
+		size_t JsonStructuralIndex::size() const
+		{
+			return positions.size();
+		}
+
+		bool JsonStructuralIndex::empty() const
+		{
+			return positions.empty();
+		}
+
+		uint32_t JsonStructuralIndex::operator[](size_t index) const
+		{
+			return positions[index];
+		}
+
+		const std::vector<uint32_t>& JsonStructuralIndex::getPositions() const
+		{
+			return positions;
+		}
+
+		JsonStructuralIndex::Implementation JsonStructuralIndex::getImplementation()
+		{
+			static const Implementation implementation = detectImplementation();
+			return implementation;
+		}
+
+		bool JsonStructuralIndex::isSupported(Implementation implementation)
+		{
+			return implementation <= getImplementation();
+		}
+
+
+		std::ostream& operator<<(std::ostream& os, const JsonStructuralIndex::Implementation& implementation)
+		{
+			switch (implementation)
+			{
+				case JsonStructuralIndex::Implementation::Scalar: os << "Scalar"; break;
+				case JsonStructuralIndex::Implementation::SSE42:  os << "SSE4.2"; break;
+				case JsonStructuralIndex::Implementation::AVX2:   os << "AVX2"; break;
+				default: os << "Unknown Implementation!"; break;
+			}
+			return os;
+		}
+	} // json
+} // r_utils
@@ -0,0 +1,243 @@
+#include "json/JsonTape.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <cstring>
+
+namespace r_utils
+{
+	namespace json
+	{
+		/**
+		 * @class JsonTapeBuilder
+		 * @brief Appends parse events to a tape.
+		 *
+		 * Container start words are written with a placeholder and patched with the
+		 * distance to their end word and their element count once the container closes.
+		 */
+		class JsonTapeBuilder : public IJsonHandler
+		{
+		public:
+			explicit JsonTapeBuilder(JsonTape& tape)
+				: words(tape.words), strings(tape.strings)
+			{}
+
+			void onStartObject() override
+			{
+				startContainer(JsonTapeTag::StartObject);
+			}
+
+			void onKey(std::string_view key) override
+			{
+				// A member is counted once, through its value.
+				appendString(key);
+			}
+
+			void onEndObject() override
+			{
+				endContainer(JsonTapeTag::EndObject);
+			}
+
+			void onStartArray() override
+			{
+				startContainer(JsonTapeTag::StartArray);
+			}
+
+			void onEndArray() override
+			{
+				endContainer(JsonTapeTag::EndArray);
+			}
+
+			void onString(std::string_view value) override
+			{
+				countValue();
+				appendString(value);
+			}
+
+			void onNumber(double value) override
+			{
+				countValue();
+				uint64_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				append(JsonTapeTag::Double, 0);
+				words.push_back(bits);
+			}
+
+			void onInt(int value) override
+			{
+				countValue();
+				append(JsonTapeTag::Int, 0);
+				words.push_back(static_cast<uint64_t>(static_cast<int64_t>(value)));
+			}
+
+			void onBoolean(bool value) override
+			{
+				countValue();
+				append(value ? JsonTapeTag::True : JsonTapeTag::False, 0);
+			}
+
+			void onNull() override
+			{
+				countValue();
+				append(JsonTapeTag::Null, 0);
+			}
+
+		private:
+			/**
+			 * @brief An open container: the index of its start word and its element count.
+			 */
+			struct Frame
+			{
+				size_t start;
+				uint64_t count;
+			};
+
+			void append(JsonTapeTag tag, uint64_t payload)
+			{
+				words.push_back((static_cast<uint64_t>(tag) << 56) | payload);
+			}
+
+			void appendString(std::string_view value)
+			{
+				if (value.size() > UINT32_MAX)
+				{
+					throw r_utils::exception::JsonParserException("String exceeds the 4 GiB limit of the tape");
+				}
+
+				append(JsonTapeTag::String, strings.size());
+
+				const uint32_t length = static_cast<uint32_t>(value.size());
+				strings.append(reinterpret_cast<const char*>(&length), sizeof(length));
+				strings.append(value);
+			}
+
+			void countValue()
+			{
+				if (!frames.empty())
+				{
+					frames.back().count++;
+				}
+			}
+
+			void startContainer(JsonTapeTag tag)
+			{
+				countValue();
+				frames.push_back(Frame{ words.size(), 0 });
+				append(tag, 0);
+			}
+
+			void endContainer(JsonTapeTag tag)
+			{
+				const Frame frame = frames.back();
+				frames.pop_back();
+
+				const uint64_t distance = words.size() - frame.start;
+				const uint64_t count = std::min<uint64_t>(frame.count, 0xFFFFFF);
+				words[frame.start] |= (count << 32) | distance;
+				append(tag, distance);
+			}
+
+			std::vector<uint64_t>& words;
+			std::string& strings;
+			std::vector<Frame> frames;
+		};
+
+
+		/** @brief Reports an element and all of its children to the handler in document order. */
+		static void emitElement(const JsonElement& element, IJsonHandler& handler)
+		{
+			switch (element.getType())
+			{
+				case JsonType::String:
+					handler.onString(element.asString());
+					break;
+				case JsonType::Int:
+					handler.onInt(element.asInt());
+					break;
+				case JsonType::Double:
+					handler.onNumber(element.asDouble());
+					break;
+				case JsonType::Boolean:
+					handler.onBoolean(element.asBoolean());
+					break;
+				case JsonType::Array:
+					handler.onStartArray();
+					for (const JsonElement& child : element.asArray().getValues())
+					{
+						emitElement(child, handler);
+					}
+					handler.onEndArray();
+					break;
+				case JsonType::Object:
+					handler.onStartObject();
+					for (const auto& [key, child] : element.asObject())
+					{
+						handler.onKey(key);
+						emitElement(child, handler);
+					}
+					handler.onEndObject();
+					break;
+				default:
+					handler.onNull();
+					break;
+			}
+		}
+
+
+		JsonTape::JsonTape()
+			: words{ static_cast<uint64_t>(JsonTapeTag::Null) << 56 }
+		{}
+
+		JsonTape JsonTape::parse(std::string_view input)
+		{
+			JsonTape tape;
+			tape.words.clear();
+			tape.words.reserve(input.size() / 4 + 1);
+			tape.strings.reserve(input.size() / 2);
+
+			JsonTapeBuilder builder(tape);
+			JsonParser::parse(input, builder);
+
+			tape.words.shrink_to_fit();
+			tape.strings.shrink_to_fit();
+			return tape;
+		}
+
+		JsonTape JsonTape::parse(const r_utils::io::File& file)
+		{
+			if (!file.exists())
+			{
+				throw r_utils::exception::JsonParserException("Failed to Parse file: " + file.getFilePath());
+			}
+
+			const std::string buffer = file.read();
+			return parse(std::string_view(buffer));
+		}
+
+		JsonTape JsonTape::fromElement(const JsonElement& element)
+		{
+			JsonTape tape;
+			tape.words.clear();
+
+			JsonTapeBuilder builder(tape);
+			emitElement(element, builder);
+			return tape;
+		}
+
+		JsonValueView JsonTape::getRoot() const
+		{
+			return JsonValueView(words.data(), strings.data());
+		}
+
+		const std::vector<uint64_t>& JsonTape::getWords() const
+		{
+			return words;
+		}
+
+		const std::string& JsonTape::getStrings() const
+		{
+			return strings;
+		}
+	} // json
+} // r_utils
@@ -0,0 +1,367 @@
+#include "json/JsonView.h"
+
+#include "exception/json/JsonArrayException.h"
+#include "exception/json/JsonElementException.h"
+#include "exception/json/JsonObjectException.h"
+
+#include <cstring>
+
+namespace r_utils
+{
+	namespace json
+	{
+		static constexpr uint64_t PAYLOAD_MASK = (uint64_t(1) << 56) - 1;
+		static constexpr uint64_t COUNT_SATURATED = 0xFFFFFF;
+
+		static JsonTapeTag tagOf(const uint64_t* word)
+		{
+			return static_cast<JsonTapeTag>(*word >> 56);
+		}
+
+		static uint64_t payloadOf(const uint64_t* word)
+		{
+			return *word & PAYLOAD_MASK;
+		}
+
+		/** @brief Returns the end word of the container starting at the given word. */
+		static const uint64_t* containerEnd(const uint64_t* word)
+		{
+			return word + (payloadOf(word) & 0xFFFFFFFF);
+		}
+
+		/** @brief Returns the element or member count stored in a container start word. */
+		static uint64_t containerCount(const uint64_t* word)
+		{
+			return payloadOf(word) >> 32;
+		}
+
+
+		JsonValueView::JsonValueView(const uint64_t* word, const char* strings)
+			: word(word), strings(strings)
+		{}
+
+		JsonType JsonValueView::getType() const
+		{
+			switch (tagOf(word))
+			{
+				case JsonTapeTag::True:
+				case JsonTapeTag::False:       return JsonType::Boolean;
+				case JsonTapeTag::Int:         return JsonType::Int;
+				case JsonTapeTag::Double:      return JsonType::Double;
+				case JsonTapeTag::String:      return JsonType::String;
+				case JsonTapeTag::StartObject: return JsonType::Object;
+				case JsonTapeTag::StartArray:  return JsonType::Array;
+				default:                       return JsonType::Null;
+			}
+		}
+
+		bool JsonValueView::isNull() const
+		{
+			return tagOf(word) == JsonTapeTag::Null;
+		}
+
+		bool JsonValueView::isString() const
+		{
+			return tagOf(word) == JsonTapeTag::String;
+		}
+
+		bool JsonValueView::isInt() const
+		{
+			return tagOf(word) == JsonTapeTag::Int;
+		}
+
+		bool JsonValueView::isDouble() const
+		{
+			return tagOf(word) == JsonTapeTag::Double;
+		}
+
+		bool JsonValueView::isBoolean() const
+		{
+			return tagOf(word) == JsonTapeTag::True || tagOf(word) == JsonTapeTag::False;
+		}
+
+		bool JsonValueView::isArray() const
+		{
+			return tagOf(word) == JsonTapeTag::StartArray;
+		}
+
+		bool JsonValueView::isObject() const
+		{
+			return tagOf(word) == JsonTapeTag::StartObject;
+		}
+
+
+		std::string_view JsonValueView::asString() const
+		{
+			if (!isString())
+			{
+				throw r_utils::exception::JsonElementException("Json is not a String");
+			}
+
+			const char* entry = strings + payloadOf(word);
+			uint32_t length;
+			std::memcpy(&length, entry, sizeof(length));
+			return std::string_view(entry + sizeof(length), length);
+		}
+
+		int JsonValueView::asInt() const
+		{
+			if (!isInt())
+			{
+				throw r_utils::exception::JsonElementException("Json is not an Int");
+			}
+			return static_cast<int>(static_cast<int64_t>(word[1]));
+		}
+
+		double JsonValueView::asDouble() const
+		{
+			if (!isDouble())
+			{
+				throw r_utils::exception::JsonElementException("Json is not a Double");
+			}
+
+			double value;
+			std::memcpy(&value, word + 1, sizeof(value));
+			return value;
+		}
+
+		bool JsonValueView::asBoolean() const
+		{
+			if (!isBoolean())
+			{
+				throw r_utils::exception::JsonElementException("Json is not a Boolean");
+			}
+			return tagOf(word) == JsonTapeTag::True;
+		}
+
+		JsonArrayView JsonValueView::asArray() const
+		{
+			if (!isArray())
+			{
+				throw r_utils::exception::JsonElementException("Json is not an Array");
+			}
+			return JsonArrayView(word, strings);
+		}
+
+		JsonObjectView JsonValueView::asObject() const
+		{
+			if (!isObject())
+			{
+				throw r_utils::exception::JsonElementException("Json is not an Object");
+			}
+			return JsonObjectView(word, strings);
+		}
+
+		JsonElement JsonValueView::toElement() const
+		{
+			switch (tagOf(word))
+			{
+				case JsonTapeTag::True:   return JsonElement(true);
+				case JsonTapeTag::False:  return JsonElement(false);
+				case JsonTapeTag::Int:    return JsonElement(asInt());
+				case JsonTapeTag::Double: return JsonElement(asDouble());
+				case JsonTapeTag::String: return JsonElement(std::string(asString()));
+				case JsonTapeTag::StartArray:
+				{
+					JsonArray array;
+					for (JsonValueView element : asArray())
+					{
+						array.add(element.toElement());
+					}
+					return JsonElement(std::move(array));
+				}
+				case JsonTapeTag::StartObject:
+				{
+					JsonObject object;
+					for (JsonObjectView::Member member : asObject())
+					{
+						object.set(std::string(member.key), member.value.toElement());
+					}
+					return JsonElement(std::move(object));
+				}
+				default:
+					return JsonElement(nullptr);
+			}
+		}
+
+		const uint64_t* JsonValueView::end() const
+		{
+			switch (tagOf(word))
+			{
+				case JsonTapeTag::Int:
+				case JsonTapeTag::Double:
+					return word + 2;
+				case JsonTapeTag::StartArray:
+				case JsonTapeTag::StartObject:
+					return containerEnd(word) + 1;
+				default:
+					return word + 1;
+			}
+		}
+
+
+		JsonArrayView::Iterator::Iterator(const uint64_t* word, const char* strings)
+			: word(word), strings(strings)
+		{}
+
+		JsonValueView JsonArrayView::Iterator::operator*() const
+		{
+			return JsonValueView(word, strings);
+		}
+
+		JsonArrayView::Iterator& JsonArrayView::Iterator::operator++()
+		{
+			word = JsonValueView(word, strings).end();
+			return *this;
+		}
+
+		JsonArrayView::Iterator JsonArrayView::Iterator::operator++(int)
+		{
+			Iterator previous = *this;
+			++(*this);
+			return previous;
+		}
+
+		bool JsonArrayView::Iterator::operator==(const Iterator& other) const
+		{
+			return word == other.word;
+		}
+
+		bool JsonArrayView::Iterator::operator!=(const Iterator& other) const
+		{
+			return word != other.word;
+		}
+
+
+		JsonArrayView::JsonArrayView(const uint64_t* word, const char* strings)
+			: word(word), strings(strings)
+		{}
+
+		size_t JsonArrayView::size() const
+		{
+			uint64_t count = containerCount(word);
+			if (count < COUNT_SATURATED)
+			{
+				return static_cast<size_t>(count);
+			}
+			return static_cast<size_t>(std::distance(begin(), end()));
+		}
+
+		bool JsonArrayView::empty() const
+		{
+			return begin() == end();
+		}
+
+		JsonValueView JsonArrayView::get(size_t index) const
+		{
+			Iterator it = begin();
+			const Iterator last = end();
+			for (size_t i = 0; i < index && it != last; ++i)
+			{
+				++it;
+			}
+
+			if (it == last)
+			{
+				throw r_utils::exception::JsonArrayException("Index out of bounds: " + std::to_string(index));
+			}
+			return *it;
+		}
+
+		JsonValueView JsonArrayView::operator[](size_t index) const
+		{
+			return get(index);
+		}
+
+		JsonArrayView::Iterator JsonArrayView::begin() const
+		{
+			return Iterator(word + 1, strings);
+		}
+
+		JsonArrayView::Iterator JsonArrayView::end() const
+		{
+			return Iterator(containerEnd(word), strings);
+		}
+
+
+		JsonObjectView::Iterator::Iterator(const uint64_t* word, const char* strings)
+			: word(word), strings(strings)
+		{}
+
+		JsonObjectView::Member JsonObjectView::Iterator::operator*() const
+		{
+			return Member{ JsonValueView(word, strings).asString(), JsonValueView(word + 1, strings) };
+		}
+
+		JsonObjectView::Iterator& JsonObjectView::Iterator::operator++()
+		{
+			word = JsonValueView(word + 1, strings).end();
+			return *this;
+		}
+
+		JsonObjectView::Iterator JsonObjectView::Iterator::operator++(int)
+		{
+			Iterator previous = *this;
+			++(*this);
+			return previous;
+		}
+
+		bool JsonObjectView::Iterator::operator==(const Iterator& other) const
+		{
+			return word == other.word;
+		}
+
+		bool JsonObjectView::Iterator::operator!=(const Iterator& other) const
+		{
+			return word != other.word;
+		}
+
+
+		JsonObjectView::JsonObjectView(const uint64_t* word, const char* strings)
+			: word(word), strings(strings)
+		{}
+
+		size_t JsonObjectView::size() const
+		{
+			uint64_t count = containerCount(word);
+			if (count < COUNT_SATURATED)
+			{
+				return static_cast<size_t>(count);
+			}
+			return static_cast<size_t>(std::distance(begin(), end()));
+		}
+
+		bool JsonObjectView::empty() const
+		{
+			return begin() == end();
+		}
+
+		bool JsonObjectView::contains(std::string_view key) const
+		{
+			for (Member member : *this)
+			{
+				if (member.key == key) return true;
+			}
+			return false;
+		}
+
+		JsonValueView JsonObjectView::get(std::string_view key) const
+		{
+			for (Member member : *this)
+			{
+				if (member.key == key) return member.value;
+			}
+			throw r_utils::exception::JsonObjectException("Key not found: " + std::string(key));
+		}
+
+		JsonObjectView::Iterator JsonObjectView::begin() const
+		{
+			return Iterator(word + 1, strings);
+		}
+
+		JsonObjectView::Iterator JsonObjectView::end() const
+		{
+			return Iterator(containerEnd(word), strings);
+		}
+	} // json
+} // r_utils
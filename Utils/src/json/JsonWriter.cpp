@@ -0,0 +1,233 @@
+#include "json/JsonWriter.h"
+
+#include "exception/file/FileException.h"
+#include "exception/json/JsonWriterException.h"
+
+namespace r_utils
+{
+	namespace json
+	{
+		JsonWriter::JsonWriter(const r_utils::io::File& file, bool prettyPrint)
+			: file(file.getFilePath(), std::ios::binary | std::ios::trunc), out(this->file), serializer(prettyPrint), prettyPrint(prettyPrint)
+		{
+			if (!this->file.is_open())
+			{
+				throw r_utils::exception::FileException("Failed to open file for writing: \"" + file.getFilePath() + "\"");
+			}
+			buffer.reserve(BUFFER_SIZE + BUFFER_SIZE / 4);
+		}
+
+		JsonWriter::JsonWriter(std::ostream& out, bool prettyPrint)
+			: out(out), serializer(prettyPrint), prettyPrint(prettyPrint)
+		{
+			buffer.reserve(BUFFER_SIZE + BUFFER_SIZE / 4);
+		}
+
+		JsonWriter::~JsonWriter()
+		{
+			try
+			{
+				flush();
+			}
+			catch (...)
+			{
+				// Errors can only be reported by calling flush() explicitly.
+			}
+		}
+
+
+		JsonWriter& JsonWriter::beginObject()
+		{
+			beforeValue();
+			buffer += '{';
+			frames.push_back(Frame{ true });
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::endObject()
+		{
+			if (frames.empty() || !frames.back().isObject || frames.back().hasKey)
+			{
+				throw r_utils::exception::JsonWriterException("endObject() without an open object");
+			}
+
+			const bool empty = frames.back().empty;
+			frames.pop_back();
+			if (prettyPrint && !empty) newline(frames.size());
+			buffer += '}';
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::beginArray()
+		{
+			beforeValue();
+			buffer += '[';
+			frames.push_back(Frame{ false });
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::endArray()
+		{
+			if (frames.empty() || frames.back().isObject)
+			{
+				throw r_utils::exception::JsonWriterException("endArray() without an open array");
+			}
+
+			const bool empty = frames.back().empty;
+			frames.pop_back();
+			if (prettyPrint && !empty) newline(frames.size());
+			buffer += ']';
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::key(std::string_view name)
+		{
+			if (frames.empty() || !frames.back().isObject || frames.back().hasKey)
+			{
+				throw r_utils::exception::JsonWriterException("key() is only allowed directly inside an object");
+			}
+
+			Frame& frame = frames.back();
+			if (!frame.empty) buffer += ',';
+			if (prettyPrint) newline(frames.size());
+
+			JsonSerializer::appendString(buffer, name);
+			buffer += prettyPrint ? ": " : ":";
+
+			frame.empty = false;
+			frame.hasKey = true;
+			return *this;
+		}
+
+
+		JsonWriter& JsonWriter::value(std::string_view value)
+		{
+			beforeValue();
+			JsonSerializer::appendString(buffer, value);
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::value(const char* value)
+		{
+			return this->value(std::string_view(value));
+		}
+
+		JsonWriter& JsonWriter::value(const std::string& value)
+		{
+			return this->value(std::string_view(value));
+		}
+
+		JsonWriter& JsonWriter::value(double value)
+		{
+			beforeValue();
+			JsonSerializer::appendNumber(buffer, value);
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::value(bool value)
+		{
+			beforeValue();
+			buffer += value ? "true" : "false";
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::value(std::nullptr_t)
+		{
+			beforeValue();
+			buffer += "null";
+			afterValue();
+			return *this;
+		}
+
+		JsonWriter& JsonWriter::value(const JsonElement& element)
+		{
+			beforeValue();
+			serializer.clear();
+			serializer.write(element, static_cast<int>(frames.size()));
+			buffer += serializer.getBuffer();
+			afterValue();
+			return *this;
+		}
+
+
+		void JsonWriter::flush()
+		{
+			drain();
+			out.flush();
+			if (!out)
+			{
+				throw r_utils::exception::JsonWriterException("Failed to write JSON output");
+			}
+		}
+
+		bool JsonWriter::complete() const
+		{
+			return written && frames.empty();
+		}
+
+
+		void JsonWriter::beforeValue()
+		{
+			if (frames.empty())
+			{
+				if (written)
+				{
+					throw r_utils::exception::JsonWriterException("A complete JSON value has already been written");
+				}
+				return;
+			}
+
+			Frame& frame = frames.back();
+			if (frame.isObject)
+			{
+				if (!frame.hasKey)
+				{
+					throw r_utils::exception::JsonWriterException("Object members need a key() before their value");
+				}
+				frame.hasKey = false;
+				return;
+			}
+
+			if (!frame.empty) buffer += ',';
+			if (prettyPrint) newline(frames.size());
+			frame.empty = false;
+		}
+
+		void JsonWriter::afterValue()
+		{
+			if (frames.empty())
+			{
+				written = true;
+			}
+			if (buffer.size() >= BUFFER_SIZE)
+			{
+				drain();
+			}
+		}
+
+		void JsonWriter::newline(size_t level)
+		{
+			buffer += '\n';
+			buffer.append(level, '\t');
+		}
+
+		void JsonWriter::drain()
+		{
+			if (buffer.empty())
+			{
+				return;
+			}
+
+			if (!out.write(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+			{
+				throw r_utils::exception::JsonWriterException("Failed to write JSON output");
+			}
+			buffer.clear();
+		}
+	} // json
+} // r_utils
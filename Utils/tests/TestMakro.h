@@ -0,0 +1,44 @@
+#pragma once
+
+#include <exception>
+#include <iostream>
+
+/**
+ * @file TestMakro.h
+ * @brief Minimal check macros for the test executables.
+ *
+ * A failed check prints its location and expression and the test keeps running, so
+ * one run reports every failure. Each test's main() ends with TEST_RESULT(), which
+ * returns a non-zero exit code if any check failed; ctest treats that as a failure.
+ */
+
+namespace r_utils
+{
+	namespace tests
+	{
+		/** @brief Number of failed checks in this test executable. */
+		inline int failures = 0;
+
+		inline void fail(const char* file, int line, const char* message)
+		{
+			failures++;
+			std::cerr << file << ":" << line << ": check failed: " << message << std::endl;
+		}
+	} // tests
+} // r_utils
+
+/** Checks that a condition holds.
+*  @param condition Expression that must be true.
+*/
+#define CHECK(condition)						do { if (!(condition)) { r_utils::tests::fail(__FILE__, __LINE__, #condition); } } while(0)
+/** Checks that an expression throws the given exception type.
+*  @param expression Expression to evaluate.
+*  @param type Exception type that must be thrown.
+*/
+#define CHECK_THROWS(expression, type)			do { try { (void)(expression); r_utils::tests::fail(__FILE__, __LINE__, #expression " did not throw " #type); } catch (const type&) {} } while(0)
+/** Checks that an expression does not throw.
+*  @param expression Expression to evaluate.
+*/
+#define CHECK_NOTHROW(expression)				do { try { (void)(expression); } catch (const std::exception& e) { r_utils::tests::fail(__FILE__, __LINE__, e.what()); } } while(0)
+/** Returns the exit code of the test from main(). */
+#define TEST_RESULT()							(r_utils::tests::failures == 0 ? 0 : 1)
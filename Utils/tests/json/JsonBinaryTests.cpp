@@ -0,0 +1,213 @@
+#include "TestMakro.h"
+
+#include "json/JsonBinary.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+/** @brief Builds a byte string from a list of byte values. */
+static std::string bytes(std::initializer_list<int> values)
+{
+	std::string out;
+	for (int value : values)
+	{
+		out += static_cast<char>(value);
+	}
+	return out;
+}
+
+class RecordingHandler : public IJsonHandler
+{
+public:
+	std::string events;
+
+	void onStartObject() override { events += "{ "; }
+	void onKey(std::string_view key) override { events += "k:" + std::string(key) + " "; }
+	void onEndObject() override { events += "} "; }
+	void onStartArray() override { events += "[ "; }
+	void onEndArray() override { events += "] "; }
+	void onString(std::string_view value) override { events += "s:" + std::string(value) + " "; }
+	void onNumber(double value) override { events += "n:" + std::to_string(value) + " "; }
+	void onInt(int value) override { events += "i:" + std::to_string(value) + " "; }
+	void onInt64(int64_t value) override { events += "l:" + std::to_string(value) + " "; }
+	void onUint64(uint64_t value) override { events += "u:" + std::to_string(value) + " "; }
+	void onBoolean(bool value) override { events += value ? "true " : "false "; }
+	void onNull() override { events += "null "; }
+};
+
+static const std::string DOCUMENT = R"({"name":"binary","values":[0,23,24,-1,-25,255,256,65536,-2147483648,2147483647,1.5,0.1,-2.5e300],
+	"flags":[true,false,null],"nested":{"empty":{},"list":[],"text":"a\u0000b"},"long":"0123456789012345678901234567890123456789"})";
+
+static void testCborEncoding()
+{
+	CHECK(JsonCbor::encode(JsonElement(0)) == bytes({ 0x00 }));
+	CHECK(JsonCbor::encode(JsonElement(23)) == bytes({ 0x17 }));
+	CHECK(JsonCbor::encode(JsonElement(24)) == bytes({ 0x18, 0x18 }));
+	CHECK(JsonCbor::encode(JsonElement(1000)) == bytes({ 0x19, 0x03, 0xE8 }));
+	CHECK(JsonCbor::encode(JsonElement(-1)) == bytes({ 0x20 }));
+	CHECK(JsonCbor::encode(JsonElement(-100)) == bytes({ 0x38, 0x63 }));
+	CHECK(JsonCbor::encode(JsonElement(1.5)) == bytes({ 0xFA, 0x3F, 0xC0, 0x00, 0x00 }));
+	CHECK(JsonCbor::encode(JsonElement(1.1)) == bytes({ 0xFB, 0x3F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A }));
+	CHECK(JsonCbor::encode(JsonElement(true)) == bytes({ 0xF5 }));
+	CHECK(JsonCbor::encode(JsonElement(nullptr)) == bytes({ 0xF6 }));
+	CHECK(JsonCbor::encode(JsonElement("a")) == bytes({ 0x61, 'a' }));
+	CHECK(JsonCbor::encode(JsonParser::parse("[1,[2]]")) == bytes({ 0x82, 0x01, 0x81, 0x02 }));
+	CHECK(JsonCbor::encode(JsonParser::parse(R"({"a":1})").asObject()) == bytes({ 0xA1, 0x61, 'a', 0x01 }));
+}
+
+static void testCborDecoding()
+{
+	CHECK(JsonCbor::decode(bytes({ 0x19, 0x03, 0xE8 })).asInt() == 1000);
+	CHECK(JsonCbor::decode(bytes({ 0xF9, 0x3C, 0x00 })).asDouble() == 1.0);
+	CHECK(JsonCbor::decode(bytes({ 0xF9, 0x7B, 0xFF })).asDouble() == 65504.0);
+	CHECK(JsonCbor::decode(bytes({ 0xF9, 0xC4, 0x00 })).asDouble() == -4.0);
+	CHECK(JsonCbor::decode(bytes({ 0xF7 })).isNull());
+
+	// Indefinite lengths, byte strings and tags.
+	CHECK(JsonCbor::decode(bytes({ 0x9F, 0x01, 0x02, 0xFF })) == JsonParser::parse("[1,2]"));
+	CHECK(JsonCbor::decode(bytes({ 0xBF, 0x61, 'a', 0x01, 0xFF })) == JsonParser::parse(R"({"a":1})"));
+	CHECK(JsonCbor::decode(bytes({ 0x7F, 0x61, 'a', 0x62, 'b', 'c', 0xFF })).asString() == "abc");
+	CHECK(JsonCbor::decode(bytes({ 0x42, 'h', 'i' })).asString() == "hi");
+	CHECK(JsonCbor::decode(bytes({ 0xC1, 0x1A, 0x00, 0x00, 0x00, 0x10 })).asInt() == 16);
+
+	RecordingHandler handler;
+	JsonCbor::decode(bytes({ 0xA2, 0x61, 'a', 0x82, 0x01, 0xF9, 0x3E, 0x00, 0x61, 'b', 0xF4 }), handler);
+	CHECK(handler.events == "{ k:a [ i:1 n:1.500000 ] k:b false } ");
+}
+
+static void testMessagePackEncoding()
+{
+	CHECK(JsonMessagePack::encode(JsonElement(127)) == bytes({ 0x7F }));
+	CHECK(JsonMessagePack::encode(JsonElement(128)) == bytes({ 0xCC, 0x80 }));
+	CHECK(JsonMessagePack::encode(JsonElement(256)) == bytes({ 0xCD, 0x01, 0x00 }));
+	CHECK(JsonMessagePack::encode(JsonElement(-1)) == bytes({ 0xFF }));
+	CHECK(JsonMessagePack::encode(JsonElement(-33)) == bytes({ 0xD0, 0xDF }));
+	CHECK(JsonMessagePack::encode(JsonElement(1.5)) == bytes({ 0xCA, 0x3F, 0xC0, 0x00, 0x00 }));
+	CHECK(JsonMessagePack::encode(JsonElement(false)) == bytes({ 0xC2 }));
+	CHECK(JsonMessagePack::encode(JsonElement(nullptr)) == bytes({ 0xC0 }));
+	CHECK(JsonMessagePack::encode(JsonElement("a")) == bytes({ 0xA1, 'a' }));
+	CHECK(JsonMessagePack::encode(JsonElement(std::string(32, 'x'))).substr(0, 2) == bytes({ 0xD9, 32 }));
+	CHECK(JsonMessagePack::encode(JsonParser::parse(R"({"a":[1]})")) == bytes({ 0x81, 0xA1, 'a', 0x91, 0x01 }));
+}
+
+static void testMessagePackDecoding()
+{
+	CHECK(JsonMessagePack::decode(bytes({ 0xCE, 0x00, 0x01, 0x00, 0x00 })).asInt() == 65536);
+	CHECK(JsonMessagePack::decode(bytes({ 0xD1, 0xFF, 0x00 })).asInt() == -256);
+	CHECK(JsonMessagePack::decode(bytes({ 0xC4, 0x02, 'h', 'i' })).asString() == "hi");
+
+	RecordingHandler handler;
+	JsonMessagePack::decode(bytes({ 0x82, 0xA1, 'a', 0x92, 0x01, 0xC0, 0xA1, 'b', 0xC3 }), handler);
+	CHECK(handler.events == "{ k:a [ i:1 null ] k:b true } ");
+}
+
+static void testWideIntegers()
+{
+	// 2^53 + 1, INT64_MIN, INT64_MAX + 1 and UINT64_MAX arrive unrounded.
+	RecordingHandler cbor;
+	JsonCbor::decode(bytes({ 0x84,
+		0x1B, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x3B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }), cbor);
+	CHECK(cbor.events == "[ l:9007199254740993 l:-9223372036854775808 u:9223372036854775808 u:18446744073709551615 ] ");
+
+	RecordingHandler msgpack;
+	JsonMessagePack::decode(bytes({ 0x94,
+		0xCF, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xD3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xD2, 0x80, 0x00, 0x00, 0x00 }), msgpack);
+	CHECK(msgpack.events == "[ l:9007199254740993 l:-9223372036854775808 l:4294967295 i:-2147483648 ] ");
+
+	// The DOM keeps them as Double, like JsonParser.
+	const JsonElement element = JsonCbor::decode(bytes({ 0x1A, 0x80, 0x00, 0x00, 0x00 }));
+	CHECK(element.isDouble());
+	CHECK(element.asDouble() == 2147483648.0);
+	CHECK(element == JsonParser::parse("2147483648"));
+	CHECK(JsonMessagePack::decode(bytes({ 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF })).asDouble() == 18446744073709551615.0);
+
+	// CBOR negatives below INT64_MIN only fit into a double.
+	RecordingHandler beyond;
+	JsonCbor::decode(bytes({ 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }), beyond);
+	CHECK(beyond.events == "n:-18446744073709551616.000000 ");
+}
+
+static void testRoundTrips()
+{
+	const JsonElement document = JsonParser::parse(DOCUMENT);
+	CHECK(JsonCbor::decode(JsonCbor::encode(document)) == document);
+	CHECK(JsonMessagePack::decode(JsonMessagePack::encode(document)) == document);
+
+	// Large containers and strings use the wider length forms.
+	JsonArray large;
+	for (int i = 0; i < 70000; ++i)
+	{
+		large.add(JsonElement(i));
+	}
+	large.add(JsonElement(std::string(70000, 's')));
+	CHECK(JsonCbor::decode(JsonCbor::encode(large)).asArray() == large);
+	CHECK(JsonMessagePack::decode(JsonMessagePack::encode(large)).asArray() == large);
+}
+
+static void testStreams()
+{
+	const JsonElement first = JsonParser::parse(DOCUMENT);
+	const JsonElement second = JsonParser::parse("[1,\"two\"]");
+
+	std::stringstream cbor;
+	JsonCbor::encode(first, cbor);
+	JsonCbor::encode(second.asArray(), cbor);
+	CHECK(cbor.str() == JsonCbor::encode(first) + JsonCbor::encode(second));
+	CHECK(JsonCbor::decode(cbor) == first);
+	CHECK(JsonCbor::decode(cbor) == second);
+
+	std::stringstream msgpack;
+	JsonMessagePack::encode(first, msgpack);
+	JsonMessagePack::encode(second, msgpack);
+	CHECK(JsonMessagePack::decode(msgpack) == first);
+	RecordingHandler handler;
+	JsonMessagePack::decode(msgpack, handler);
+	CHECK(handler.events == "[ i:1 s:two ] ");
+}
+
+static void testErrors()
+{
+	CHECK_THROWS(JsonCbor::decode(""), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0x19, 0x03 })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0x82, 0x01 })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0x63, 'a', 'b' })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0x9F, 0x01 })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0xFF })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0xF0 })), JsonParserException);
+	CHECK_THROWS(JsonCbor::decode(bytes({ 0x1F })), JsonParserException);
+
+	CHECK_THROWS(JsonMessagePack::decode(""), JsonParserException);
+	CHECK_THROWS(JsonMessagePack::decode(bytes({ 0xCD, 0x01 })), JsonParserException);
+	CHECK_THROWS(JsonMessagePack::decode(bytes({ 0x92, 0x01 })), JsonParserException);
+	CHECK_THROWS(JsonMessagePack::decode(bytes({ 0xD4, 0x01, 0x02 })), JsonParserException);
+	CHECK_THROWS(JsonMessagePack::decode(bytes({ 0xC1 })), JsonParserException);
+
+	std::stringstream empty;
+	CHECK_THROWS(JsonCbor::decode(empty), JsonParserException);
+}
+
+int main()
+{
+	testCborEncoding();
+	testCborDecoding();
+	testMessagePackEncoding();
+	testMessagePackDecoding();
+	testWideIntegers();
+	testRoundTrips();
+	testStreams();
+	testErrors();
+	return TEST_RESULT();
+}
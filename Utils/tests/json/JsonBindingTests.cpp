@@ -0,0 +1,110 @@
+#include "TestMakro.h"
+
+#include "json/JsonBinding.h"
+
+#include "exception/json/JsonBindingException.h"
+#include "exception/json/JsonParserException.h"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace binding_tests
+{
+	struct Address
+	{
+		std::string city;
+		std::optional<int> zip;
+	};
+	R_UTILS_JSON_FIELDS(Address, city, zip)
+
+	struct Record
+	{
+		std::string name;
+		int64_t id = 0;
+		uint64_t size = 0;
+		int8_t level = 0;
+		double ratio = 0;
+		bool active = false;
+		std::vector<int64_t> values;
+		std::optional<int64_t> parent;
+		Address address;
+	};
+	R_UTILS_JSON_FIELDS(Record, name, id, size, level, ratio, active, values, parent, address)
+}
+
+using namespace r_utils::json;
+using binding_tests::Record;
+using r_utils::exception::JsonBindingException;
+using r_utils::exception::JsonParserException;
+
+static void testRoundTrip()
+{
+	Record record;
+	record.name = "bound";
+	record.id = std::numeric_limits<int64_t>::min();
+	record.size = std::numeric_limits<uint64_t>::max();
+	record.level = -128;
+	record.ratio = 0.25;
+	record.active = true;
+	record.values = { 1, -9007199254740993, std::numeric_limits<int64_t>::max() };
+	record.parent = 9007199254740993;
+	record.address = { "Berlin", 10115 };
+
+	const Record copy = JsonBinding::parse<Record>(JsonBinding::stringify(record));
+	CHECK(copy.name == record.name);
+	CHECK(copy.id == record.id);
+	CHECK(copy.size == record.size);
+	CHECK(copy.level == record.level);
+	CHECK(copy.ratio == record.ratio);
+	CHECK(copy.active);
+	CHECK(copy.values == record.values);
+	CHECK(copy.parent == record.parent);
+	CHECK(copy.address.city == "Berlin");
+	CHECK(copy.address.zip == 10115);
+}
+
+static void testIntegerPrecision()
+{
+	CHECK(JsonBinding::parse<Record>(R"({"id":9007199254740993})").id == 9007199254740993);
+	CHECK(JsonBinding::parse<Record>(R"({"id":9223372036854775807})").id == std::numeric_limits<int64_t>::max());
+	CHECK(JsonBinding::parse<Record>(R"({"id":-9223372036854775808})").id == std::numeric_limits<int64_t>::min());
+	CHECK(JsonBinding::parse<Record>(R"({"size":18446744073709551615})").size == std::numeric_limits<uint64_t>::max());
+	CHECK(JsonBinding::parse<Record>(R"({"parent":9007199254740993})").parent == 9007199254740993);
+	CHECK(JsonBinding::parse<Record>(R"({"ratio":9007199254740993})").ratio == 9007199254740992.0);
+	CHECK(JsonBinding::parse<Record>(R"({"id":1e3})").id == 1000);
+}
+
+static void testIntegerRange()
+{
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"id":9223372036854775808})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"size":18446744073709551616})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"size":-1})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"level":128})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"id":1.5})"), JsonBindingException);
+	// Beyond 2^53 a literal with an exponent may already have been rounded.
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"id":9.007199254740993e15})"), JsonBindingException);
+}
+
+static void testTypeMismatchesAndSkipping()
+{
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"name":1})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"values":{}})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"id":"1"})"), JsonBindingException);
+	CHECK_THROWS(JsonBinding::parse<Record>(R"({"id":1} {"id":2})"), JsonParserException);
+
+	const Record record = JsonBinding::parse<Record>(R"({"unknown":{"id":[1,2]},"id":5,"parent":null})");
+	CHECK(record.id == 5);
+	CHECK(!record.parent.has_value());
+}
+
+int main()
+{
+	testRoundTrip();
+	testIntegerPrecision();
+	testIntegerRange();
+	testTypeMismatchesAndSkipping();
+	return TEST_RESULT();
+}
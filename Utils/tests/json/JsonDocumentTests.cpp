@@ -0,0 +1,127 @@
+#include "TestMakro.h"
+
+#include "json/JsonDocument.h"
+#include "json/JsonParser.h"
+#include "file/File.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <filesystem>
+#include <string>
+#include <utility>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+static void testNavigation()
+{
+	const JsonDocument document = JsonDocument::parse(R"({"name":"doc","list":[1.5,"x\ty",true,null,{}],"nested":{"k":false}})");
+	const JsonNode& root = document.getRoot();
+
+	CHECK(root.isObject());
+	CHECK(root.size() == 3);
+	CHECK(root.get("name").asString() == "doc");
+	CHECK(root.contains("list"));
+	CHECK(!root.contains("missing"));
+
+	const JsonNode& list = root.get("list");
+	CHECK(list.isArray());
+	CHECK(list.size() == 5);
+	CHECK(list[0].asDouble() == 1.5);
+	CHECK(list[1].asString() == "x\ty");
+	CHECK(list[2].asBoolean());
+	CHECK(list[3].isNull());
+	CHECK(list[4].isObject() && list[4].size() == 0);
+	CHECK(root.get("nested").get("k").isBoolean());
+
+	size_t members = 0;
+	for (const JsonMember& member : root.getMembers())
+	{
+		CHECK(root.contains(member.key));
+		members++;
+	}
+	CHECK(members == 3);
+	CHECK(list.getElements().size() == 5);
+}
+
+static void testMatchesTree()
+{
+	const std::string texts[] = {
+		R"({"a":[1,2,[3,[4]]],"b":{"c":{"d":"e\"f"}},"g":-0.5})",
+		R"([])",
+		R"("scalar")",
+		R"([{"k":"v"},{"k":"w"},{}])",
+	};
+	for (const std::string& text : texts)
+	{
+		CHECK(JsonDocument::parse(text).getRoot().toElement() == JsonParser::parse(text));
+	}
+
+	std::string large = "[";
+	for (int i = 0; i < 5000; ++i)
+	{
+		if (i > 0) large += ',';
+		large += R"({"id":)" + std::to_string(i) + R"(,"name":"item)" + std::to_string(i) + R"("})";
+	}
+	large += ']';
+	const JsonDocument document = JsonDocument::parse(large);
+	CHECK(document.getRoot().size() == 5000);
+	CHECK(document.getRoot()[4999].get("name").asString() == "item4999");
+	CHECK(document.getRoot().toElement() == JsonParser::parse(large));
+}
+
+static void testMove()
+{
+	JsonDocument document = JsonDocument::parse(R"({"a":["b"]})");
+	const JsonDocument moved = std::move(document);
+	CHECK(moved.getRoot().get("a")[0].asString() == "b");
+}
+
+static void testParseMapped()
+{
+	const std::string path = (std::filesystem::temp_directory_path() / "r_utils_json_document_mapped.json").string();
+	r_utils::io::File file(path);
+
+	std::string text = R"({"plain":"in place","escaped":"a\nb","list":[)";
+	for (int i = 0; i < 5000; ++i)
+	{
+		if (i > 0) text += ',';
+		text += R"({"id":)" + std::to_string(i) + R"(,"name":"item)" + std::to_string(i) + R"("})";
+	}
+	text += "]}";
+	file.write(text);
+
+	{
+		JsonDocument mapped = JsonDocument::parseMapped(file);
+		CHECK(mapped.getRoot().toElement() == JsonParser::parse(text));
+		CHECK(mapped.getRoot().get("escaped").asString() == "a\nb");
+
+		// Strings reference the mapping, which moves along with the document.
+		const JsonDocument moved = std::move(mapped);
+		CHECK(moved.getRoot().get("plain").asString() == "in place");
+		CHECK(moved.getRoot().get("list")[4999].get("name").asString() == "item4999");
+	}
+
+	file.write("[1,2] 3");
+	CHECK_THROWS(JsonDocument::parseMapped(file), JsonParserException);
+
+	file.remove();
+	CHECK_THROWS(JsonDocument::parseMapped(file), JsonParserException);
+}
+
+static void testErrors()
+{
+	CHECK_THROWS(JsonDocument::parse(R"({"a":)"), JsonParserException);
+	CHECK_THROWS(JsonDocument::parse("[1,2"), JsonParserException);
+	CHECK_THROWS(JsonDocument::parse("[1] 2"), JsonParserException);
+}
+
+int main()
+{
+	testNavigation();
+	testMatchesTree();
+	testMove();
+	testParseMapped();
+	testErrors();
+	return TEST_RESULT();
+}
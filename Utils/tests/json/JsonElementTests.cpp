@@ -0,0 +1,203 @@
+#include "TestMakro.h"
+
+#include "json/JsonElement.h"
+#include "json/JsonParser.h"
+#include "json/JsonPatch.h"
+#include "json/JsonKeyPool.h"
+
+#include "exception/json/JsonElementException.h"
+#include "exception/json/JsonObjectException.h"
+
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+using namespace r_utils::json;
+
+static void testAccessorsReturnReferences()
+{
+	const JsonElement document = JsonParser::parse(R"({"a":{"b":[1,2,3]},"s":"text"})");
+
+	// Repeated lookups return the same stored element instead of copies.
+	CHECK(&document.asObject() == &document.asObject());
+	CHECK(&document.asObject().get("a") == &document.asObject().get("a"));
+	CHECK(&document.asObject().get("a").asObject().get("b").asArray()[1] == &document.asObject().get("a").asObject().get("b").asArray().get(1));
+	CHECK(&document.asObject().get("s").asString() == &document.asObject().get("s").asString());
+}
+
+static void testMutationInPlace()
+{
+	JsonElement document = JsonParser::parse(R"({"a":{"b":[1,2,3]},"s":"text"})");
+
+	document.asObject().get("a").asObject().get("b").asArray()[1] = JsonElement(20);
+	document.asObject().get("s").asString() += "!";
+	document.asObject().get("a").asObject().set("c", JsonElement(true));
+
+	CHECK(document == JsonParser::parse(R"({"a":{"b":[1,20,3],"c":true},"s":"text!"})"));
+	CHECK_THROWS(document.asObject().get("s").asArray(), r_utils::exception::JsonElementException);
+	CHECK_THROWS(document.asObject().get("missing"), r_utils::exception::JsonObjectException);
+	CHECK_THROWS(document.asObject().get(-1), r_utils::exception::JsonObjectException);
+	CHECK_THROWS(document.asObject().get(2), r_utils::exception::JsonObjectException);
+}
+
+static void testMoveAwareMutation()
+{
+	std::string large(1000, 'x');
+	const char* data = large.data();
+
+	JsonArray array;
+	array.add(JsonElement(std::move(large)));
+	// The string buffer was moved into the element, not copied.
+	CHECK(array[0].asString().data() == data);
+
+	JsonElement& added = array.emplace("emplaced");
+	CHECK(added.asString() == "emplaced");
+	CHECK(array.size() == 2);
+
+	JsonObject object;
+	JsonArray nested;
+	nested.add(JsonElement(1));
+	object.set("nested", JsonElement(std::move(nested)));
+	JsonElement& value = object.emplace("value", 2.5);
+	CHECK(value.asDouble() == 2.5);
+	CHECK(object.get("nested").asArray().size() == 1);
+	CHECK(object.size() == 2);
+
+	object.remove("value");
+	CHECK(!object.contains("value"));
+}
+
+static void testLayout()
+{
+	static_assert(sizeof(void*) != 8 || sizeof(JsonElement) == 16, "JsonElement must stay 16 bytes");
+
+	const JsonElement values[] = {
+		JsonElement(), JsonElement(nullptr), JsonElement(7), JsonElement(-1.25), JsonElement(false),
+		JsonElement("string"), JsonElement(std::string(500, 's')), JsonParser::parse("[1,[2]]"), JsonParser::parse(R"({"a":{}})")
+	};
+	for (const JsonElement& value : values)
+	{
+		JsonElement copy = value;
+		CHECK(copy == value);
+		CHECK(copy.getType() == value.getType());
+
+		JsonElement moved = std::move(copy);
+		CHECK(moved == value);
+
+		JsonElement assigned(1);
+		assigned = value;
+		CHECK(assigned == value);
+		assigned = JsonElement("replaced");
+		CHECK(assigned.asString() == "replaced");
+	}
+
+	CHECK(std::get<int>(JsonElement(7).getValue()) == 7);
+	CHECK(std::get<std::string>(JsonElement("s").getValue()) == "s");
+	CHECK(std::get<JsonArray>(JsonParser::parse("[1]").getValue()).size() == 1);
+
+	// Moving an element hands over the heap payload.
+	JsonElement source(std::string(100, 'x'));
+	const std::string* payload = &source.asString();
+	JsonElement target = std::move(source);
+	CHECK(&target.asString() == payload);
+}
+
+static void testKeys()
+{
+	const JsonKey shortKey("id");
+	const JsonKey copy = shortKey;
+	const JsonKey longKey(std::string(100, 'k'));
+
+	CHECK(copy == shortKey);
+	CHECK(copy.str() == "id");
+	CHECK(longKey.size() == 100);
+	CHECK(JsonKey().empty());
+
+	JsonKeyPool pool;
+	const JsonKey pooled = pool.intern("id");
+	CHECK(pooled.sameAs(pool.intern("id")));
+	CHECK(pooled == shortKey);
+	CHECK(!pooled.sameAs(shortKey));
+	CHECK(JsonParser::parse(R"({"id":1})", pool) == JsonParser::parse(R"({"id":1})"));
+}
+
+static void testCopyOnWrite()
+{
+	JsonElement document = JsonParser::parse(R"({"a":{"b":[1,2,3]},"c":{"d":"e"},"s":"text"})");
+	const JsonElement snapshot = document;
+	CHECK(snapshot.sharesWith(document));
+
+	document.asObject().get("a").asObject().get("b").asArray()[1] = JsonElement(20);
+
+	CHECK(snapshot == JsonParser::parse(R"({"a":{"b":[1,2,3]},"c":{"d":"e"},"s":"text"})"));
+	CHECK(document.asObject().get("a").asObject().get("b").asArray()[1].asInt() == 20);
+	CHECK(!snapshot.sharesWith(document));
+	// The untouched siblings are still shared after the edit.
+	CHECK(snapshot.asObject().get("c").sharesWith(document.asObject().get("c")));
+	CHECK(snapshot.asObject().get("s").sharesWith(document.asObject().get("s")));
+
+	// Strings detach on their own as well.
+	JsonElement text("shared");
+	const JsonElement copy = text;
+	text.asString() += "!";
+	CHECK(copy.asString() == "shared");
+	CHECK(text.asString() == "shared!");
+}
+
+static void testEqualityAndHash()
+{
+	const JsonElement x = JsonParser::parse(R"({"a":[1,2.5,"s",null,true],"b":{}})");
+	const JsonElement y = JsonParser::parse(R"({"b":{},"a":[1,2.5,"s",null,true]})");
+	JsonElement z = y;
+	z.asObject().get("a").asArray()[0] = JsonElement(2);
+
+	// Member order does not change the hash, just like equality.
+	CHECK(x == y);
+	CHECK(x.hash() == y.hash());
+	CHECK(x != z);
+	CHECK(x.hash() != z.hash());
+	CHECK(y != z);
+
+	// The mutable accessors drop the cached hash on the way to the edit.
+	const uint64_t before = z.hash();
+	z.asObject().get("a").asArray()[0] = JsonElement(1);
+	CHECK(z.hash() != before);
+	CHECK(z == x);
+	CHECK(z.hash() == x.hash());
+
+	CHECK(JsonElement(1).hash() != JsonElement(1.0).hash());
+	CHECK(JsonParser::parse("[]").hash() != JsonParser::parse("{}").hash());
+	CHECK(JsonParser::parse("[1,2]").hash() != JsonParser::parse("[2,1]").hash());
+
+	const std::unordered_set<JsonElement> unique = { x, y, z, JsonParser::parse("[1]"), JsonParser::parse("[1]") };
+	CHECK(unique.size() == 2);
+
+	// Writes through references held across hashing still compare correctly.
+	JsonElement held = JsonParser::parse("[1,2]");
+	JsonArray& array = held.asArray();
+	CHECK(held.hash() != 0);
+	array.add(JsonElement(3));
+	CHECK(held == JsonParser::parse("[1,2,3]"));
+	CHECK(held != JsonParser::parse("[1,2]"));
+
+	const JsonElement original = JsonParser::parse(R"({"a":{"b":[1]}})");
+	JsonElement nested = JsonParser::parse(R"({"a":{"b":[1]}})");
+	JsonArray& inner = nested.asObject().get("a").asObject().get("b").asArray();
+	CHECK(JsonPatch::diff(original, nested).size() == 0);
+	inner.add(JsonElement(2));
+	CHECK(nested == JsonParser::parse(R"({"a":{"b":[1,2]}})"));
+	CHECK(nested != original);
+	CHECK(JsonPatch::diff(original, nested).size() == 1);
+}
+
+int main()
+{
+	testAccessorsReturnReferences();
+	testMutationInPlace();
+	testMoveAwareMutation();
+	testLayout();
+	testKeys();
+	testCopyOnWrite();
+	testEqualityAndHash();
+	return TEST_RESULT();
+}
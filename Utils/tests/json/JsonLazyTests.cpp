@@ -0,0 +1,98 @@
+#include "TestMakro.h"
+
+#include "json/Json.h"
+#include "json/JsonLazy.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <string>
+#include <vector>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+static void testAccess()
+{
+	const std::string text = R"({"name":"lazy","list":[1.5,"a\"b",true,null,[],{}],"nested":{"deep":{"x":false}}})";
+	const JsonLazyDocument document = Json::parseLazy(text);
+
+	CHECK(document.isObject());
+	const JsonLazyObject root = document.asObject();
+	CHECK(root.size() == 3);
+	CHECK(root.contains("nested"));
+	CHECK(!root.contains("missing"));
+	CHECK(root.get("name").asString() == "lazy");
+	CHECK(root["nested"].asObject()["deep"].asObject()["x"].isBoolean());
+	CHECK(root.getKeys() == std::vector<std::string>({ "name", "list", "nested" }));
+
+	const JsonLazyArray list = root.get("list").asArray();
+	CHECK(list.size() == 6);
+	CHECK(list[0].asDouble() == 1.5);
+	CHECK(list[1].asString() == "a\"b");
+	CHECK(list[2].asBoolean());
+	CHECK(list[3].isNull());
+	CHECK(list[4].asArray().empty());
+	CHECK(list[5].asObject().empty());
+	CHECK(list[1].getRaw() == R"("a\"b")");
+
+	size_t count = 0;
+	for (JsonLazyValue value : list)
+	{
+		CHECK(value.toElement() == JsonParser::parse(value.getRaw()));
+		count++;
+	}
+	CHECK(count == 6);
+}
+
+static void testMatchesTree()
+{
+	const std::string texts[] = {
+		R"({"a":[1,2,[3,[4]]],"b":{"c":{"d":"e"}},"g":-0.5})",
+		R"([])",
+		R"("scalar")",
+		R"([{"k":"v"},{"k":"w"},{}])",
+	};
+	for (const std::string& text : texts)
+	{
+		CHECK(JsonLazyDocument(text).getRoot().toElement() == JsonParser::parse(text));
+	}
+}
+
+static void testSkippedSubtreesAreNotParsed()
+{
+	// The broken scalar is only reported once it is accessed.
+	const JsonLazyDocument document(R"({"bad":[tru],"good":1})");
+	CHECK(document.asObject().get("good").asInt() == 1);
+	CHECK_THROWS(document.asObject().get("bad").asArray()[0].asBoolean(), JsonParserException);
+}
+
+static void testStructureErrors()
+{
+	CHECK_THROWS(JsonLazyDocument(R"({"a":[1,2})"), JsonParserException);
+	CHECK_THROWS(JsonLazyDocument("[1,2"), JsonParserException);
+	CHECK_THROWS(JsonLazyDocument(R"({"a":"unterminated)"), JsonParserException);
+	CHECK_THROWS(JsonLazyDocument("]"), JsonParserException);
+}
+
+static void testTrailingContent()
+{
+	// The same inputs the eager parser rejects.
+	for (const char* text : { "true e", "{} -", "1 null", "[1] 2", R"({"a":1} {"b":2})", "\"s\" []", "[]]" })
+	{
+		CHECK_THROWS(JsonLazyDocument(text), JsonParserException);
+		CHECK_THROWS(JsonParser::parse(text), JsonParserException);
+	}
+	CHECK_NOTHROW(JsonLazyDocument(" {\"a\":[1]} \r\n"));
+	CHECK(JsonLazyDocument(" 42 \n").getRoot().getRaw() == "42");
+}
+
+int main()
+{
+	testAccess();
+	testMatchesTree();
+	testSkippedSubtreesAreNotParsed();
+	testStructureErrors();
+	testTrailingContent();
+	return TEST_RESULT();
+}
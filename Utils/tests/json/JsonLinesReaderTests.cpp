@@ -0,0 +1,90 @@
+#include "TestMakro.h"
+
+#include "json/JsonLinesReader.h"
+#include "json/JsonParser.h"
+#include "file/File.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+static void testReadsEveryLine()
+{
+	const JsonLinesReader reader(2);
+	const std::vector<JsonElement> records = reader.read("{\"a\":1}\n\n  [2]  \r\n\"three\"\n4");
+
+	CHECK(records.size() == 4);
+	CHECK(records[0] == JsonParser::parse("{\"a\":1}"));
+	CHECK(records[1].asArray().size() == 1);
+	CHECK(records[2].asString() == "three");
+	CHECK(records[3] == JsonParser::parse("4"));
+}
+
+static void testReadsFile()
+{
+	r_utils::io::File file((std::filesystem::temp_directory_path() / "r_utils_json_lines_test.ndjson").string());
+	CHECK(file.write("{\"a\":1}\n[2]\n"));
+
+	const JsonLinesReader reader(2);
+	CHECK(reader.read(file).size() == 2);
+	size_t count = 0;
+	reader.read(file, [&count](JsonElement) { count++; });
+	CHECK(count == 2);
+
+	// A missing file is reported like in JsonParser::parse(File).
+	file.remove();
+	CHECK_THROWS(reader.read(file), JsonParserException);
+	CHECK_THROWS(reader.read(file, [](JsonElement) {}), JsonParserException);
+}
+
+static void testKeepsOrderAcrossBatches()
+{
+	std::string input;
+	for (int i = 0; i < 100000; ++i)
+	{
+		input += "{\"id\":" + std::to_string(i) + ",\"name\":\"record\"}\n";
+	}
+
+	int expected = 0;
+	bool ordered = true;
+	JsonLinesReader(3).read(std::string_view(input), [&](JsonElement record) {
+		ordered = ordered && record.asObject().get("id") == JsonParser::parse(std::to_string(expected));
+		expected++;
+	});
+	CHECK(ordered);
+	CHECK(expected == 100000);
+}
+
+static void testRejectsSecondValueOnALine()
+{
+	const JsonLinesReader reader(2);
+
+	CHECK_THROWS(reader.read("{\"a\":1}\n{\"a\":1} {\"b\":2}\n"), JsonParserException);
+	CHECK_THROWS(reader.read("1\n2 3\n"), JsonParserException);
+	CHECK_THROWS(reader.read("[1]]\n"), JsonParserException);
+
+	try
+	{
+		reader.read("1\n2\n3 x\n4\n");
+		CHECK(false);
+	}
+	catch (const JsonParserException& error)
+	{
+		CHECK(std::string_view(error.what()).find("Line 3:") != std::string_view::npos);
+	}
+}
+
+int main()
+{
+	testReadsEveryLine();
+	testReadsFile();
+	testKeepsOrderAcrossBatches();
+	testRejectsSecondValueOnALine();
+	return TEST_RESULT();
+}
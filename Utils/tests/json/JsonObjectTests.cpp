@@ -0,0 +1,99 @@
+#include "TestMakro.h"
+
+#include "json/JsonObject.h"
+#include "json/JsonElement.h"
+#include "json/JsonParser.h"
+#include "json/JsonSerializer.h"
+
+#include "exception/json/JsonObjectException.h"
+
+#include <string>
+#include <vector>
+
+using namespace r_utils::json;
+
+static std::vector<std::string> keysOf(const JsonObject& object)
+{
+	std::vector<std::string> keys;
+	for (const JsonObject::Member& member : object)
+	{
+		keys.push_back(member.first);
+	}
+	return keys;
+}
+
+static void testInsertionOrder()
+{
+	JsonObject object;
+	object.set("zeta", JsonElement(1)).set("alpha", JsonElement(2)).set("mid", JsonElement(3));
+	CHECK(keysOf(object) == std::vector<std::string>({ "zeta", "alpha", "mid" }));
+
+	// Overwriting keeps the member in place.
+	object.set("alpha", JsonElement(20));
+	CHECK(keysOf(object) == std::vector<std::string>({ "zeta", "alpha", "mid" }));
+	CHECK(object.get("alpha").asInt() == 20);
+
+	object.remove("zeta");
+	CHECK(keysOf(object) == std::vector<std::string>({ "alpha", "mid" }));
+	object.remove("missing");
+	CHECK(object.size() == 2);
+
+	const std::string text = R"({"b":1,"a":2,"c":{"y":1,"x":2}})";
+	CHECK(JsonSerializer::serialize(JsonParser::parse(text)) == text);
+}
+
+static void testIndexAccess()
+{
+	const JsonElement element = JsonParser::parse(R"({"first":"a","second":"b","third":"c"})");
+	const JsonObject& object = element.asObject();
+
+	CHECK(object.get(0).asString() == "a");
+	CHECK(object.get(2).asString() == "c");
+	CHECK(&object.get(1) == &object.get("second"));
+	CHECK_THROWS(object.get(3), r_utils::exception::JsonObjectException);
+}
+
+static void testLargeObjects()
+{
+	// Past INDEX_THRESHOLD members, lookups go through the hash index.
+	JsonObject object;
+	for (int i = 0; i < 1000; ++i)
+	{
+		object.set("key" + std::to_string(i), JsonElement(i));
+	}
+	CHECK(object.size() == 1000);
+	CHECK(object.get("key0").asInt() == 0);
+	CHECK(object.get("key999").asInt() == 999);
+	CHECK(object.get(500).asInt() == 500);
+	CHECK(!object.contains("key1000"));
+
+	for (int i = 0; i < 1000; i += 2)
+	{
+		object.remove("key" + std::to_string(i));
+	}
+	CHECK(object.size() == 500);
+	CHECK(!object.contains("key0"));
+	CHECK(object.get("key1").asInt() == 1);
+	CHECK(object.get(0).asInt() == 1);
+	CHECK(object.get("key999").asInt() == 999);
+
+	object.set("key1", JsonElement(-1));
+	CHECK(object.get(0).asInt() == -1);
+	CHECK(object.size() == 500);
+}
+
+static void testEqualityIgnoresOrder()
+{
+	CHECK(JsonParser::parse(R"({"a":1,"b":2})") == JsonParser::parse(R"({"b":2,"a":1})"));
+	CHECK(JsonParser::parse(R"({"a":1,"b":2})") != JsonParser::parse(R"({"a":1,"b":3})"));
+	CHECK(JsonParser::parse(R"({"a":1})") != JsonParser::parse(R"({"a":1,"b":2})"));
+}
+
+int main()
+{
+	testInsertionOrder();
+	testIndexAccess();
+	testLargeObjects();
+	testEqualityIgnoresOrder();
+	return TEST_RESULT();
+}
@@ -0,0 +1,272 @@
+#include "TestMakro.h"
+
+#include "json/JsonParser.h"
+#include "json/JsonKeyPool.h"
+#include "file/File.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+/** @brief Records every event as a short token. */
+class RecordingHandler : public IJsonHandler
+{
+public:
+	std::string events;
+
+	void onStartObject() override { events += "{ "; }
+	void onKey(std::string_view key) override { events += "k:" + std::string(key) + " "; }
+	void onEndObject() override { events += "} "; }
+	void onStartArray() override { events += "[ "; }
+	void onEndArray() override { events += "] "; }
+	void onString(std::string_view value) override { events += "s:" + std::string(value) + " "; }
+	void onNumber(double value) override { events += "n:" + std::to_string(value) + " "; }
+	void onBoolean(bool value) override { events += value ? "true " : "false "; }
+	void onNull() override { events += "null "; }
+};
+
+static void testParsesBorrowedView()
+{
+	const std::string buffer = R"(xx{"a":[true,null,"s\"t"],"b":{}}yy)";
+	const std::string_view view = std::string_view(buffer).substr(2, buffer.size() - 4);
+
+	const JsonElement element = JsonParser::parse(view);
+	CHECK(element.asObject().size() == 2);
+	CHECK(element.asObject().get("a").asArray().size() == 3);
+	CHECK(element.asObject().get("a").asArray()[0].asBoolean());
+	CHECK(element.asObject().get("a").asArray()[1].isNull());
+	CHECK(element.asObject().get("a").asArray()[2].asString() == "s\"t");
+	CHECK(element == JsonParser::parse(std::string(view)));
+
+	// A scalar that ends exactly at the end of the view.
+	CHECK(JsonParser::parse(std::string_view("truex", 4)).asBoolean());
+}
+
+static void testParsesFile()
+{
+	const std::string path = (std::filesystem::temp_directory_path() / "r_utils_json_parser_test.json").string();
+	const std::string text = R"({"name":"file","values":[1.5,"x",false],"nested":{"k":null}})";
+
+	r_utils::io::File file(path);
+	CHECK(file.write(text));
+	CHECK(JsonParser::parse(file) == JsonParser::parse(text));
+
+	// Events from a file come from a mapping and match those from the text.
+	RecordingHandler fromFile;
+	RecordingHandler fromText;
+	JsonParser::parse(file, fromFile);
+	JsonParser::parse(text, fromText);
+	CHECK(fromFile.events == fromText.events);
+
+	CHECK(file.write(""));
+	RecordingHandler empty;
+	CHECK_THROWS(JsonParser::parse(file, empty), JsonParserException);
+	file.remove();
+	CHECK_THROWS(JsonParser::parse(file, empty), JsonParserException);
+}
+
+static void testErrors()
+{
+	CHECK_THROWS(JsonParser::parse(R"({"a":"unterminated)"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("[1,"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"a" 1})"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("tru"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(""), JsonParserException);
+}
+
+static void testUnicodeEscapes()
+{
+	CHECK(JsonParser::parse(R"("\u0001")").asString() == "\x01");
+	CHECK(JsonParser::parse(R"("\u0041")").asString() == "A");
+	CHECK(JsonParser::parse(R"("a\u00e9\u20AC\/b")").asString() == "a\xC3\xA9\xE2\x82\xAC/b");
+	CHECK(JsonParser::parse(R"("\ud83d\ude00")").asString() == "\xF0\x9F\x98\x80");
+	CHECK(JsonParser::parse(R"({"\u006b":"\u0000"})").asObject().get("k").asString() == std::string(1, '\0'));
+
+	RecordingHandler handler;
+	JsonParser::parse(R"(["\u0041\uD834\uDD1E"])", handler);
+	CHECK(handler.events == "[ s:A\xF0\x9D\x84\x9E ] ");
+
+	// Lone or malformed surrogates and bad hex digits are errors.
+	for (const char* text : { R"("\ud83d")", R"("\ud83dx")", R"("\ud83d\n")", R"("\ud83d\u0041")", R"("\ude00")", R"("\u00g1")", R"("\u12")" })
+	{
+		CHECK_THROWS(JsonParser::parse(text), JsonParserException);
+	}
+}
+
+static void testHandlerEvents()
+{
+	RecordingHandler handler;
+	JsonParser::parse(R"({"a":[1.5,"x\ny",true,null],"b":{},"c\"":false})", handler);
+	CHECK(handler.events == "{ k:a [ n:1.500000 s:x\ny true null ] k:b { } k:c\" false } ");
+
+	RecordingHandler scalar;
+	JsonParser::parse("  \"text\" ", scalar);
+	CHECK(scalar.events == "s:text ");
+
+	RecordingHandler broken;
+	CHECK_THROWS(JsonParser::parse(R"({"a":[1,2})", broken), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("[1] 2", broken), JsonParserException);
+}
+
+static void testHandlerAcrossIndexWindows()
+{
+	// Larger than one index window, with strings that cross window boundaries.
+	std::string text = "[";
+	for (int i = 0; i < 20000; ++i)
+	{
+		if (i > 0) text += ',';
+		text += R"({"key\"":"value with \\ escapes",)" + std::string(i % 7, ' ') + R"("n":[true,null]})";
+	}
+	text += ']';
+
+	size_t objects = 0;
+	class CountingHandler : public IJsonHandler
+	{
+	public:
+		size_t& objects;
+		explicit CountingHandler(size_t& objects) : objects(objects) {}
+		void onStartObject() override { objects++; }
+	} handler(objects);
+
+	JsonParser::parse(text, handler);
+	CHECK(objects == 20000);
+	CHECK(JsonParser::parse(text).asArray().size() == 20000);
+}
+
+static void testTrailingContent()
+{
+	CHECK_THROWS(JsonParser::parse(R"({"a":1} {"b":2})"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("1 abc"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("[1]]"), JsonParserException);
+	CHECK_NOTHROW(JsonParser::parse(" {\"a\":[1]} \r\n"));
+
+	JsonKeyPool keys;
+	CHECK_THROWS(JsonParser::parse("{} {}", keys), JsonParserException);
+}
+
+static void testNumbers()
+{
+	CHECK(JsonParser::parse("2147483647").isInt());
+	CHECK(JsonParser::parse("2147483647").asInt() == 2147483647);
+	CHECK(JsonParser::parse("-2147483648").isInt());
+	CHECK(JsonParser::parse("2147483648").isDouble());
+	CHECK(JsonParser::parse("2147483648").asDouble() == 2147483648.0);
+	CHECK(JsonParser::parse("-2147483649").isDouble());
+
+	CHECK(JsonParser::parse("-0").isInt());
+	CHECK(JsonParser::parse("-0").asInt() == 0);
+	CHECK(JsonParser::parse("-0.0").isDouble());
+	CHECK(std::signbit(JsonParser::parse("-0.0").asDouble()));
+
+	CHECK(JsonParser::parse("1e3").isDouble());
+	CHECK(JsonParser::parse("1e3").asDouble() == 1000.0);
+	CHECK(JsonParser::parse("1E+3").asDouble() == 1000.0);
+	CHECK(JsonParser::parse("2.5e-3").asDouble() == 0.0025);
+	CHECK(JsonParser::parse("-1.5E2").asDouble() == -150.0);
+	CHECK(JsonParser::parse("[0.1,-7,1e2]") == JsonParser::parse("[1e-1,-7,100.0]"));
+
+	// Underflow keeps the nearest double: a denormal, or zero with its sign.
+	CHECK(JsonParser::parse("1e-310").asDouble() == 1e-310);
+	CHECK(JsonParser::parse("4.9e-324").asDouble() > 0.0);
+	CHECK(JsonParser::parse("1e-400").isDouble());
+	CHECK(JsonParser::parse("1e-400").asDouble() == 0.0);
+	CHECK(!std::signbit(JsonParser::parse("1e-400").asDouble()));
+	CHECK(std::signbit(JsonParser::parse("-1e-400").asDouble()));
+	CHECK(JsonParser::parse("0.00001e-320").asDouble() == 0.0);
+	CHECK(JsonParser::parse("1234e-99999999999").asDouble() == 0.0);
+	CHECK(JsonParser::parse("0e999999").asDouble() == 0.0);
+	CHECK(JsonParser::parse("1.7976931348623157e308").asDouble() == 1.7976931348623157e308);
+
+	// Overflow is an error rather than infinity, which JSON cannot represent.
+	CHECK_THROWS(JsonParser::parse("1e400"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("-1e400"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("1.8e308"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("0.01e311"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("[1e99999999999]"), JsonParserException);
+
+	CHECK_THROWS(JsonParser::parse("1e"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("--1"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("-"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("[.5]"), JsonParserException);
+	CHECK_THROWS(JsonParser::parse("1.5.2"), JsonParserException);
+
+	class NumberHandler : public IJsonHandler
+	{
+	public:
+		std::string events;
+		void onInt(int value) override { events += "i:" + std::to_string(value) + " "; }
+		void onNumber(double value) override { events += "n:" + std::to_string(value) + " "; }
+	} handler;
+	JsonParser::parse("[1,-2,2.5,3e0,2147483648]", handler);
+	CHECK(handler.events == "i:1 i:-2 n:2.500000 n:3.000000 n:2147483648.000000 ");
+}
+
+/** @brief Builds an array of objects that is large enough to be split across threads. */
+static std::string largeArray(size_t count)
+{
+	std::string text = "[";
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (i > 0) text += ',';
+		text += R"({"id":)" + std::to_string(i) + R"(,"tags":["a","b"],"nested":{"x":[1,{"y":null}]}})";
+	}
+	return text;
+}
+
+static void testParallelMatchesSequential()
+{
+	const std::string text = largeArray(40000) + "]";
+	// Inputs below 1 MiB are parsed on the calling thread.
+	CHECK(text.size() > 1024 * 1024);
+
+	const JsonElement sequential = JsonParser::parse(text);
+	for (unsigned int threads : { 1u, 2u, 3u, 8u })
+	{
+		const JsonElement parallel = JsonParser::parseParallel(text, threads);
+		CHECK(parallel == sequential);
+	}
+	CHECK(JsonParser::parseParallel(text, 4).asArray().size() == 40000);
+}
+
+static void testParallelSmallAndNonArrayInputs()
+{
+	CHECK(JsonParser::parseParallel("[]", 4) == JsonParser::parse("[]"));
+	CHECK(JsonParser::parseParallel(R"({"a":[1,2]})", 4) == JsonParser::parse(R"({"a":[1,2]})"));
+	CHECK(JsonParser::parseParallel("  42 ", 4).asInt() == 42);
+}
+
+static void testParallelErrors()
+{
+	const std::string body = largeArray(40000);
+
+	CHECK_THROWS(JsonParser::parseParallel(body + "}", 4), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(body + "}"), JsonParserException);
+	CHECK_THROWS(JsonParser::parseParallel(body + R"(,{"a":[1}])", 4), JsonParserException);
+	CHECK_THROWS(JsonParser::parseParallel(body + R"(,[1,2}])", 4), JsonParserException);
+	CHECK_THROWS(JsonParser::parseParallel(body, 4), JsonParserException);
+
+	CHECK_THROWS(JsonParser::parseParallel(body + "] 5", 4), JsonParserException);
+	CHECK_NOTHROW(JsonParser::parseParallel(body + "] \n\t", 4));
+}
+
+int main()
+{
+	testParsesBorrowedView();
+	testParsesFile();
+	testErrors();
+	testUnicodeEscapes();
+	testTrailingContent();
+	testNumbers();
+	testHandlerEvents();
+	testHandlerAcrossIndexWindows();
+	testParallelMatchesSequential();
+	testParallelSmallAndNonArrayInputs();
+	testParallelErrors();
+	return TEST_RESULT();
+}
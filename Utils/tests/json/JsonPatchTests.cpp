@@ -0,0 +1,102 @@
+#include "TestMakro.h"
+
+#include "json/JsonPatch.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonPatchException.h"
+
+#include <random>
+#include <string>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonPatchException;
+
+static void testApply()
+{
+	JsonElement document = JsonParser::parse(R"({"user":{"name":"Ada","roles":["admin"]},"n":1})");
+	JsonPatch::apply(document, JsonParser::parse(R"([
+		{"op":"replace","path":"/user/name","value":"Bro"},
+		{"op":"add","path":"/user/roles/-","value":"dev"},
+		{"op":"remove","path":"/n"},
+		{"op":"copy","from":"/user/name","path":"/copy"},
+		{"op":"test","path":"/copy","value":"Bro"}
+	])").asArray());
+
+	CHECK(document == JsonParser::parse(R"({"user":{"name":"Bro","roles":["admin","dev"]},"copy":"Bro"})"));
+}
+
+static void testFailedPatchLeavesDocumentUnchanged()
+{
+	JsonElement document = JsonParser::parse(R"({"a":1})");
+	const JsonElement original = document;
+
+	CHECK_THROWS(JsonPatch::apply(document, JsonParser::parse(R"([{"op":"add","path":"/b","value":2},{"op":"test","path":"/a","value":3}])").asArray()), JsonPatchException);
+	CHECK(document == original);
+	CHECK_THROWS(JsonPatch::apply(document, JsonParser::parse(R"([{"op":"remove","path":"/missing"}])").asArray()), JsonPatchException);
+	CHECK(document == original);
+}
+
+/** @brief Builds a small random document so that diffs cover objects, arrays and scalars. */
+static JsonElement randomDocument(std::mt19937& random, int depth)
+{
+	switch (depth > 0 ? random() % 4 : random() % 2)
+	{
+		case 0:
+			return JsonElement(static_cast<int>(random() % 5));
+		case 1:
+			return JsonElement(std::string(1, static_cast<char>('a' + random() % 3)));
+		case 2:
+		{
+			JsonArray array;
+			for (unsigned int i = random() % 5; i > 0; --i) array.add(randomDocument(random, depth - 1));
+			return JsonElement(std::move(array));
+		}
+		default:
+		{
+			JsonObject object;
+			for (unsigned int i = random() % 4; i > 0; --i)
+			{
+				object.set(std::string(1, static_cast<char>('k' + random() % 4)), randomDocument(random, depth - 1));
+			}
+			return JsonElement(std::move(object));
+		}
+	}
+}
+
+static void testDiffRoundTrips()
+{
+	std::mt19937 random(24);
+	for (int round = 0; round < 2000; ++round)
+	{
+		const JsonElement source = randomDocument(random, 3);
+		const JsonElement target = randomDocument(random, 3);
+
+		JsonElement patched = source;
+		JsonPatch::apply(patched, JsonPatch::diff(source, target));
+		CHECK(patched == target);
+
+		CHECK(JsonPatch::diff(source, source).size() == 0);
+	}
+}
+
+static void testMergePatch()
+{
+	JsonElement document = JsonParser::parse(R"({"a":"b","c":{"d":"e","f":"g"}})");
+	JsonPatch::merge(document, JsonParser::parse(R"({"a":"z","c":{"f":null}})"));
+	CHECK(document == JsonParser::parse(R"({"a":"z","c":{"d":"e"}})"));
+
+	const JsonElement source = JsonParser::parse(R"({"a":1,"b":{"c":[1,2]},"d":true})");
+	const JsonElement target = JsonParser::parse(R"({"a":2,"b":{"c":[3]},"e":"new"})");
+	JsonElement patched = source;
+	JsonPatch::merge(patched, JsonPatch::mergeDiff(source, target));
+	CHECK(patched == target);
+}
+
+int main()
+{
+	testApply();
+	testFailedPatchLeavesDocumentUnchanged();
+	testDiffRoundTrips();
+	testMergePatch();
+	return TEST_RESULT();
+}
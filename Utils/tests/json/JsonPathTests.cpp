@@ -0,0 +1,138 @@
+#include "TestMakro.h"
+
+#include "json/JsonPath.h"
+#include "json/JsonPointer.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonPathException.h"
+
+#include <string>
+#include <vector>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonPathException;
+
+static const JsonElement STORE = JsonParser::parse(R"({
+	"store": {
+		"book": [
+			{ "title": "A", "price": 8.95, "tags": ["x"] },
+			{ "title": "B", "price": 12, "isbn": "1" },
+			{ "title": "C", "price": 8, "isbn": "2" },
+			{ "title": "D", "price": 22.99 }
+		],
+		"bicycle": { "color": "red", "price": 19.95 }
+	},
+	"a/b": 1,
+	"m~n": 2
+})");
+
+/** @brief Evaluates a path and returns the titles of the selected books. */
+static std::vector<std::string> titles(const std::string& path)
+{
+	std::vector<std::string> result;
+	for (const JsonElement* element : JsonPath(path).evaluate(STORE))
+	{
+		result.push_back(element->asString());
+	}
+	return result;
+}
+
+static void testPointer()
+{
+	CHECK(JsonPointer("").evaluate(STORE) == &STORE);
+	CHECK(JsonPointer("").isRoot());
+	CHECK(JsonPointer("/store/book/1/title").evaluate(STORE)->asString() == "B");
+	CHECK(JsonPointer("/store/book/4").evaluate(STORE) == nullptr);
+	CHECK(JsonPointer("/store/book/-").evaluate(STORE) == nullptr);
+	CHECK(JsonPointer("/store/missing/x").evaluate(STORE) == nullptr);
+	CHECK(JsonPointer("/store/book/01").evaluate(STORE) == nullptr);
+
+	// RFC 6901 escaping: "~1" is '/', "~0" is '~', and "~01" is "~1", not '/'.
+	CHECK(JsonPointer("/a~1b").evaluate(STORE)->asInt() == 1);
+	CHECK(JsonPointer("/m~0n").evaluate(STORE)->asInt() == 2);
+	CHECK(JsonPointer("/").evaluate(STORE) == nullptr);
+	CHECK(JsonPointer("/m~01").getTokens()[0].name == "m~1");
+	CHECK(JsonPointer::escape("a/b~c") == "a~1b~0c");
+	CHECK(JsonPointer("/a~1b/0").toString() == "/a~1b/0");
+	CHECK(JsonPointer("/x").append("a/b").toString() == "/x/a~1b");
+	CHECK(JsonPointer("/x/y").parent() == JsonPointer("/x"));
+	CHECK(JsonPointer("").parent().isRoot());
+
+	CHECK_THROWS(JsonPointer("no/slash"), JsonPathException);
+	CHECK_THROWS(JsonPointer("/bad~2escape"), JsonPathException);
+	CHECK_THROWS(JsonPointer("/trailing~"), JsonPathException);
+
+	JsonElement copy = STORE;
+	*JsonPointer("/store/bicycle/color").evaluate(copy) = JsonElement("blue");
+	CHECK(copy.asObject().get("store").asObject().get("bicycle").asObject().get("color").asString() == "blue");
+}
+
+static void testSteps()
+{
+	CHECK(titles("$.store.book[0].title") == std::vector<std::string>({ "A" }));
+	CHECK(titles("$['store']['book'][1]['title']") == std::vector<std::string>({ "B" }));
+	CHECK(titles("$.store.book[-1].title") == std::vector<std::string>({ "D" }));
+	CHECK(titles("$.store.book[-4].title") == std::vector<std::string>({ "A" }));
+	CHECK(titles("$.store.book[-5].title").empty());
+	CHECK(titles("$.store.book[*].title") == std::vector<std::string>({ "A", "B", "C", "D" }));
+	CHECK(JsonPath("$.store.bicycle.*").evaluate(STORE).size() == 2);
+	CHECK(JsonPath("$").evaluate(STORE).size() == 1);
+	CHECK(JsonPath("$").first(STORE) == &STORE);
+	CHECK(JsonPath("$.missing").first(STORE) == nullptr);
+}
+
+static void testDescendants()
+{
+	CHECK(titles("$..title") == std::vector<std::string>({ "A", "B", "C", "D" }));
+	CHECK(JsonPath("$..price").evaluate(STORE).size() == 5);
+	CHECK(JsonPath("$.store..color").evaluate(STORE).size() == 1);
+	// book and bicycle, 4 books, 11 book members, 1 tag and 2 bicycle members.
+	CHECK(JsonPath("$.store..*").evaluate(STORE).size() == 20);
+	CHECK(JsonPath("$..price").first(STORE)->asDouble() == 8.95);
+}
+
+static void testFilters()
+{
+	CHECK(titles("$.store.book[?(@.isbn)].title") == std::vector<std::string>({ "B", "C" }));
+	CHECK(titles("$.store.book[?(@.tags[0])].title") == std::vector<std::string>({ "A" }));
+	CHECK(titles("$.store.book[?(@.price < 10)].title") == std::vector<std::string>({ "A", "C" }));
+	CHECK(titles("$.store.book[?(@.price <= 12)].title") == std::vector<std::string>({ "A", "B", "C" }));
+	CHECK(titles("$.store.book[?(@.price > 12)].title") == std::vector<std::string>({ "D" }));
+	CHECK(titles("$.store.book[?(@.price >= 12)].title") == std::vector<std::string>({ "B", "D" }));
+	CHECK(titles("$.store.book[?(@.title != 'A')].title") == std::vector<std::string>({ "B", "C", "D" }));
+	CHECK(titles("$.store.book[?(@.title == \"C\")].title") == std::vector<std::string>({ "C" }));
+	CHECK(titles("$.store.book[?(@.title < 'C')].title") == std::vector<std::string>({ "A", "B" }));
+
+	// Int and Double values compare by their numeric value.
+	CHECK(titles("$.store.book[?(@.price == 12.0)].title") == std::vector<std::string>({ "B" }));
+	CHECK(titles("$.store.book[?(@.price == 8)].title") == std::vector<std::string>({ "C" }));
+	CHECK(titles("$.store.book[?(@.price != 12)].title") == std::vector<std::string>({ "A", "C", "D" }));
+
+	// Comparing different kinds never matches.
+	CHECK(titles("$.store.book[?(@.price < 'z')].title").empty());
+	CHECK(titles("$.store.book[?(@.isbn == 1)].title").empty());
+
+	const JsonElement flags = JsonParser::parse(R"([{"v":true},{"v":null},{"v":false}])");
+	CHECK(JsonPath("$[?(@.v == true)]").evaluate(flags).size() == 1);
+	CHECK(JsonPath("$[?(@.v == null)]").evaluate(flags).size() == 1);
+	CHECK(JsonPath("$[?(@.v != false)]").evaluate(flags).size() == 2);
+}
+
+static void testErrors()
+{
+	CHECK_THROWS(JsonPath("store.book"), JsonPathException);
+	CHECK_THROWS(JsonPath("$.store[0"), JsonPathException);
+	CHECK_THROWS(JsonPath("$[?(@.price ~ 1)]"), JsonPathException);
+	CHECK_THROWS(JsonPath("$['unterminated]"), JsonPathException);
+	CHECK_THROWS(JsonPath("$."), JsonPathException);
+}
+
+int main()
+{
+	testPointer();
+	testSteps();
+	testDescendants();
+	testFilters();
+	testErrors();
+	return TEST_RESULT();
+}
@@ -0,0 +1,117 @@
+#include "TestMakro.h"
+
+#include "json/JsonProjection.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+#include "exception/json/JsonPathException.h"
+
+#include <string>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+using r_utils::exception::JsonPathException;
+
+static const std::string RECORD = R"({
+	"id": 7,
+	"request": { "path": "/x", "method": "GET", "headers": { "a": [1, {"b": 2}] } },
+	"tags": ["t1", "t2", "t3"],
+	"items": [ { "id": 1, "price": 2.5 }, { "price": 3 }, 4, { "id": 5, "nested": [[], {}] } ],
+	"escaped": "a\"}]b",
+	"big": [ { "deep": [ [ { "x": "]" } ] ] } ]
+})";
+
+static bool projects(const JsonProjection& projection, const std::string& expected)
+{
+	return JsonParser::parse(RECORD, projection) == JsonParser::parse(expected);
+}
+
+static void testTrie()
+{
+	JsonProjection projection{ "/id", "/request/path", "/request/method" };
+	CHECK(!projection.empty());
+	CHECK(projects(projection, R"({"id":7,"request":{"path":"/x","method":"GET"}})"));
+
+	// Paths that share a prefix share trie nodes.
+	CHECK(projection.child(JsonProjection::ROOT, "request") != JsonProjection::NONE);
+	CHECK(projection.child(projection.child(JsonProjection::ROOT, "request"), "path") != JsonProjection::NONE);
+	CHECK(projection.child(JsonProjection::ROOT, "path") == JsonProjection::NONE);
+
+	// Selecting a container keeps it whole, even when a deeper path also names it.
+	CHECK(projects(JsonProjection{ "/request/headers/a/1", "/request" }, R"({"request":{"path":"/x","method":"GET","headers":{"a":[1,{"b":2}]}}})"));
+	CHECK(projects(JsonProjection{ "/request/headers/a/1/b" }, R"({"request":{"headers":{"a":[{"b":2}]}}})"));
+	CHECK(projects(JsonProjection{ "/tags/2" }, R"({"tags":["t3"]})"));
+	CHECK(projects(JsonProjection{ "/escaped", "/big" }, R"({"escaped":"a\"}]b","big":[{"deep":[[{"x":"]"}]]}]})"));
+
+	// Paths that match nothing leave only the root.
+	CHECK(JsonProjection().empty());
+	CHECK(projects(JsonProjection(), "{}"));
+	CHECK(projects(JsonProjection{ "/missing", "/request/missing", "/tags/9", "/id/x" }, "{}"));
+	CHECK(projects(JsonProjection{ "" }, RECORD));
+
+	// A numeric token also matches an object key.
+	CHECK(JsonParser::parse(R"({"0":1,"1":2})", JsonProjection{ "/0" }) == JsonParser::parse(R"({"0":1})"));
+	CHECK(JsonParser::parse(R"({"a/b":1,"c":2})", JsonProjection{ "/a~1b" }) == JsonParser::parse(R"({"a/b":1})"));
+}
+
+static void testWildcard()
+{
+	// Elements of a "*" array keep their positions; ones without a match become empty or null.
+	CHECK(projects(JsonProjection{ "/items/*/id" }, R"({"items":[{"id":1},{},null,{"id":5}]})"));
+	CHECK(projects(JsonProjection{ "/items/*" }, R"({"items":[{"id":1,"price":2.5},{"price":3},4,{"id":5,"nested":[[],{}]}]})"));
+	CHECK(projects(JsonProjection{ "/tags/*" }, R"({"tags":["t1","t2","t3"]})"));
+
+	// Numbered tokens under a "*" array add to the "*" paths, in either order.
+	const JsonProjection both{ "/items/*/price", "/items/0/id" };
+	CHECK(both.hasWildcard(both.child(JsonProjection::ROOT, "items")));
+	CHECK(projects(both, R"({"items":[{"id":1,"price":2.5},{"price":3},null,{}]})"));
+	CHECK(projects(JsonProjection{ "/items/3/id", "/items/*/price", "/items/3/nested/1" }, R"({"items":[{"price":2.5},{"price":3},null,{"id":5,"nested":[{}]}]})"));
+	CHECK(projects(JsonProjection{ "/items/*/price", "/items/1" }, R"({"items":[{"price":2.5},{"price":3},null,{}]})"));
+	CHECK(JsonParser::parse(R"({"a":[{"x":1,"y":2}]})", JsonProjection{ "/a/*/x", "/a/0/y" }) == JsonParser::parse(R"({"a":[{"x":1,"y":2}]})"));
+	CHECK(JsonParser::parse(R"({"a":[[1,2],[3,4]]})", JsonProjection{ "/a/1/0", "/a/*/1" }) == JsonParser::parse(R"({"a":[[2],[3,4]]})"));
+
+	// On objects a numbered token stays a key and "*" adds nothing.
+	CHECK(JsonParser::parse(R"({"a":{"0":{"x":1,"y":2}}})", JsonProjection{ "/a/*/x", "/a/0/y" }) == JsonParser::parse(R"({"a":{"0":{"y":2}}})"));
+
+	// "*" does not match object members.
+	CHECK(projects(JsonProjection{ "/request/*" }, "{}"));
+
+	CHECK(JsonParser::parse("[[1,2],[3],4]", JsonProjection{ "/*/*" }) == JsonParser::parse("[[1,2],[3],null]"));
+	CHECK(JsonParser::parse("[[1,2],[3]]", JsonProjection{ "/*/0" }) == JsonParser::parse("[[1],[3]]"));
+}
+
+static void testErrors()
+{
+	const JsonProjection projection{ "/a" };
+	CHECK_THROWS(JsonProjection{ "a" }, JsonPathException);
+	CHECK_THROWS(JsonProjection().add("/~2"), JsonPathException);
+
+	CHECK_THROWS(JsonParser::parse(R"({"a":1)", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"a":1 "b":2})", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"a" 1})", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"b":,"a":1})", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"a":1} {})", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"([1 2])", projection), JsonParserException);
+	CHECK_NOTHROW(JsonParser::parse(" {\"a\":1} \n", projection));
+
+	// Skipped values must close each bracket with its own kind, like the full parser.
+	for (const char* text : { R"({"b":[1,2},"a":1})", R"({"b":{"c":1]],"a":1})", R"({"b":[{]},"a":1})", R"({"b":[[]}],"a":1})", R"([{"x":1]])" })
+	{
+		CHECK_THROWS(JsonParser::parse(text, projection), JsonParserException);
+		CHECK_THROWS(JsonParser::parse(text), JsonParserException);
+	}
+	CHECK_THROWS(JsonParser::parse(R"({"b":[1,{"c":2})", projection), JsonParserException);
+	CHECK_THROWS(JsonParser::parse(R"({"b":}, "a":1})", projection), JsonParserException);
+	CHECK(JsonParser::parse(R"({"b":[1,{"c":[]}],"a":1})", projection) == JsonParser::parse(R"({"a":1})"));
+
+	// Scalars and separators inside a skipped value are not validated.
+	CHECK(JsonParser::parse(R"({"b":[tru, nul],"a":1})", projection) == JsonParser::parse(R"({"a":1})"));
+}
+
+int main()
+{
+	testTrie();
+	testWildcard();
+	testErrors();
+	return TEST_RESULT();
+}
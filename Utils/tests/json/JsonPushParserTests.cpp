@@ -0,0 +1,135 @@
+#include "TestMakro.h"
+
+#include "json/JsonPushParser.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonParserException;
+
+static const char* DOCUMENTS[] = {
+	R"({"name":"push","values":[1,-2.5,300,-0.125],"flags":[true,false,null],"nested":{"a":{"b":[]}}})",
+	R"(["esc\"aped","back\\slash","line\nbreak","\u0041\u00e9","tab\t",""])",
+	R"(["\ud83d\ude00\u20ac","\u0001\/",{"\u006b":"\uD834\uDD1E"}])",
+	R"(  [ { } , [ ] , "" , 0 , -1 , 12345678 ]  )",
+	R"([3e2,-0.125E-2,1.5e+10,2147483647,2147483648,-0])",
+	R"("just a string")",
+	R"({"k\"ey":"v\\","x":true})",
+};
+
+/** @brief Feeds the text in chunks of the given size and collects every top-level value. */
+static std::vector<JsonElement> feedInChunks(std::string_view text, size_t chunkSize)
+{
+	std::vector<JsonElement> values;
+	JsonPushParser parser([&](JsonElement value) { values.push_back(std::move(value)); });
+	for (size_t offset = 0; offset < text.size(); offset += chunkSize)
+	{
+		parser.feed(text.substr(offset, chunkSize));
+	}
+	parser.finish();
+	return values;
+}
+
+static void testEveryChunkSize()
+{
+	for (const char* document : DOCUMENTS)
+	{
+		const std::string text = document;
+		const JsonElement expected = JsonParser::parse(text);
+		for (size_t chunkSize = 1; chunkSize <= text.size(); ++chunkSize)
+		{
+			const std::vector<JsonElement> values = feedInChunks(text, chunkSize);
+			CHECK(values.size() == 1);
+			CHECK(values.size() == 1 && values[0] == expected);
+		}
+	}
+}
+
+static void testUnicodeEscapes()
+{
+	// Escapes and surrogate pairs decode the same however the chunks split them.
+	const std::string text = R"(["\u0041\u00e9","\ud83d\ude00"])";
+	for (size_t chunkSize = 1; chunkSize <= text.size(); ++chunkSize)
+	{
+		const std::vector<JsonElement> values = feedInChunks(text, chunkSize);
+		CHECK(values.size() == 1 && values[0] == JsonParser::parse(R"(["A\u00e9","\ud83d\ude00"])"));
+		CHECK(values.size() == 1 && values[0].asArray().get(1).asString() == "\xF0\x9F\x98\x80");
+	}
+
+	for (const char* text : { R"("\ud83d")", R"("\ud83d\n")", R"("\ude00")", R"("\u00g1")" })
+	{
+		for (size_t chunkSize = 1; chunkSize <= 3; ++chunkSize)
+		{
+			CHECK_THROWS(feedInChunks(text, chunkSize), JsonParserException);
+		}
+	}
+}
+
+static void testTopLevelScalars()
+{
+	// Numbers and literals at the end of the input are only complete after finish().
+	for (size_t chunkSize = 1; chunkSize <= 4; ++chunkSize)
+	{
+		CHECK(feedInChunks("-12.5", chunkSize) == std::vector<JsonElement>{ JsonElement(-12.5) });
+		CHECK(feedInChunks("1e3", chunkSize) == std::vector<JsonElement>{ JsonElement(1000.0) });
+		CHECK(feedInChunks("true", chunkSize) == std::vector<JsonElement>{ JsonElement(true) });
+		CHECK(feedInChunks("null", chunkSize) == std::vector<JsonElement>{ JsonElement(nullptr) });
+	}
+
+	size_t count = 0;
+	JsonPushParser parser([&](JsonElement) { count++; });
+	parser.feed("42");
+	CHECK(count == 0);
+	parser.finish();
+	CHECK(count == 1);
+}
+
+static void testMultipleValues()
+{
+	const std::string text = "1 [2]\n{\"a\":3}\t\"x\" false{}[]null";
+	const std::vector<JsonElement> expected = {
+		JsonParser::parse("1"), JsonParser::parse("[2]"), JsonParser::parse("{\"a\":3}"), JsonElement("x"),
+		JsonElement(false), JsonParser::parse("{}"), JsonParser::parse("[]"), JsonElement(nullptr)
+	};
+	for (size_t chunkSize = 1; chunkSize <= text.size(); ++chunkSize)
+	{
+		CHECK(feedInChunks(text, chunkSize) == expected);
+	}
+}
+
+static void testTruncatedInput()
+{
+	const char* truncated[] = { R"({"a":)", R"("abc)", "[1,", "tru", R"({"a")", R"(["\u00)", "-", "1e" };
+	for (const char* text : truncated)
+	{
+		for (size_t chunkSize = 1; chunkSize <= 3; ++chunkSize)
+		{
+			CHECK_THROWS(feedInChunks(text, chunkSize), JsonParserException);
+		}
+	}
+}
+
+static void testMalformedInput()
+{
+	CHECK_THROWS(feedInChunks("[1 2]", 1), JsonParserException);
+	CHECK_THROWS(feedInChunks("[1}", 2), JsonParserException);
+	CHECK_THROWS(feedInChunks(R"({"a" 1})", 3), JsonParserException);
+	CHECK_THROWS(feedInChunks("trux", 1), JsonParserException);
+	CHECK_THROWS(feedInChunks("]", 1), JsonParserException);
+}
+
+int main()
+{
+	testEveryChunkSize();
+	testUnicodeEscapes();
+	testTopLevelScalars();
+	testMultipleValues();
+	testTruncatedInput();
+	testMalformedInput();
+	return TEST_RESULT();
+}
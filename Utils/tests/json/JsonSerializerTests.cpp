@@ -0,0 +1,122 @@
+#include "TestMakro.h"
+
+#include "json/JsonSerializer.h"
+#include "json/JsonParser.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+using namespace r_utils::json;
+
+/** @brief Escapes a string byte by byte, as a reference for the vectorized scan. */
+static std::string escapeReference(const std::string& value)
+{
+	static constexpr char HEX[] = "0123456789abcdef";
+	std::string out = "\"";
+	for (char c : value)
+	{
+		switch (c)
+		{
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\t': out += "\\t"; break;
+			case '\r': out += "\\r"; break;
+			case '\b': out += "\\b"; break;
+			case '\f': out += "\\f"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					out += "\\u00";
+					out += HEX[c >> 4];
+					out += HEX[c & 0xF];
+				}
+				else
+				{
+					out += c;
+				}
+				break;
+		}
+	}
+	return out + "\"";
+}
+
+static void testScalars()
+{
+	CHECK(JsonSerializer::serialize(JsonElement(42)) == "42");
+	CHECK(JsonSerializer::serialize(JsonElement(-2147483647 - 1)) == "-2147483648");
+	CHECK(JsonSerializer::serialize(JsonElement(1.0)) == "1.0");
+	CHECK(JsonSerializer::serialize(JsonElement(0.1)) == "0.1");
+	CHECK(JsonSerializer::serialize(JsonElement(-2.5e-8)) == "-2.5e-08");
+	CHECK(JsonSerializer::serialize(JsonElement(std::numeric_limits<double>::quiet_NaN())) == "null");
+	CHECK(JsonSerializer::serialize(JsonElement(std::numeric_limits<double>::infinity())) == "null");
+	CHECK(JsonSerializer::serialize(JsonElement(true)) == "true");
+	CHECK(JsonSerializer::serialize(JsonElement(nullptr)) == "null");
+	CHECK(JsonSerializer::serialize(JsonElement("text")) == "\"text\"");
+}
+
+static void testStringEscapes()
+{
+	CHECK(JsonSerializer::serialize(JsonElement("a\"b\\c\nd\te\x01")) == R"("a\"b\\c\nd\te\u0001")");
+
+	// Special characters at every position of strings longer than one 16-byte chunk.
+	for (size_t length = 0; length < 40; ++length)
+	{
+		for (size_t position = 0; position < length; ++position)
+		{
+			for (char special : { '"', '\\', '\n', '\x1f', '\x7f' })
+			{
+				std::string value(length, 'x');
+				value[position] = special;
+
+				std::string out;
+				JsonSerializer::appendString(out, value);
+				CHECK(out == escapeReference(value));
+			}
+		}
+	}
+}
+
+static void testContainers()
+{
+	CHECK(JsonSerializer::serialize(JsonParser::parse(R"([1,"x",[],{},[null,false]])")) == R"([1,"x",[],{},[null,false]])");
+	CHECK(JsonSerializer::serialize(JsonParser::parse(R"({"a":{"b":[1.5]}})")) == R"({"a":{"b":[1.5]}})");
+
+	CHECK(JsonSerializer::serialize(JsonParser::parse("[1,2]"), true) == "[1, 2]");
+	CHECK(JsonSerializer::serialize(JsonParser::parse(R"({"a":[1,2]})"), true) == "{\n\t\"a\": [1, 2]\n}");
+	CHECK(JsonSerializer::serialize(JsonParser::parse("[[1],{}]"), true) == "[\n\t[1],\n\t{}\n]");
+
+	JsonSerializer serializer;
+	serializer.write(JsonElement(1));
+	CHECK(serializer.getBuffer() == "1");
+	serializer.clear();
+	serializer.write(JsonParser::parse("[true]").asArray());
+	CHECK(serializer.take() == "[true]");
+}
+
+static void testRoundTrip()
+{
+	const std::string text = R"({"name":"serializer","values":[1,-2.5,1e300,0.1,"\u0001\"",[{"deep":[null]}]],"flag":false})";
+	const JsonElement element = JsonParser::parse(text);
+
+	CHECK(JsonParser::parse(JsonSerializer::serialize(element)) == element);
+	CHECK(JsonParser::parse(JsonSerializer::serialize(element, true)) == element);
+
+	// Control characters come back from their \u escapes, not just equally mangled.
+	CHECK(element.asObject().get("values").asArray().get(4).asString() == "\x01\"");
+	for (int c = 0; c < 0x20; ++c)
+	{
+		const std::string value = "a" + std::string(1, static_cast<char>(c)) + "b";
+		CHECK(JsonParser::parse(JsonSerializer::serialize(JsonElement(value))).asString() == value);
+	}
+}
+
+int main()
+{
+	testScalars();
+	testStringEscapes();
+	testContainers();
+	testRoundTrip();
+	return TEST_RESULT();
+}
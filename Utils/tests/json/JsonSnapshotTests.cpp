@@ -0,0 +1,178 @@
+#include "TestMakro.h"
+
+#include "json/JsonSnapshot.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
+using namespace r_utils::json;
+using r_utils::io::File;
+using r_utils::exception::JsonParserException;
+
+static const std::string DOCUMENT = R"({"a":[1,2.5,"x\ny",true,false,null,{"k":[[],{}]}],"b":{"c":"d"},"e":[],"f":-3})";
+
+static std::string tempPath(const std::string& name)
+{
+	return (std::filesystem::temp_directory_path() / ("r_utils_" + name)).string();
+}
+
+static std::string readBytes(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeBytes(const std::string& path, const std::string& bytes)
+{
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+/** @brief Visits every value of a view, so that any out-of-bounds read would happen. */
+static size_t visit(JsonValueView value)
+{
+	size_t visited = 1;
+	if (value.isArray())
+	{
+		for (JsonValueView element : value.asArray()) visited += visit(element);
+	}
+	else if (value.isObject())
+	{
+		for (JsonObjectView::Member member : value.asObject()) visited += member.key.size() + visit(member.value);
+	}
+	else if (value.isString())
+	{
+		visited += value.asString().size();
+	}
+	return visited;
+}
+
+static void testRoundTrip()
+{
+	const std::string path = tempPath("snapshot.snap");
+	const JsonElement element = JsonParser::parse(DOCUMENT);
+
+	JsonSnapshot::write(JsonTape::parse(DOCUMENT), File(path));
+	{
+		const JsonSnapshot snapshot = JsonSnapshot::open(File(path));
+		CHECK_NOTHROW(snapshot.validate());
+		CHECK(snapshot.getRoot().toElement() == element);
+		CHECK(snapshot.getRoot().asObject().size() == 4);
+		CHECK(snapshot.getRoot().asObject().get("a").asArray().size() == 7);
+		CHECK(snapshot.getRoot().asObject().get("a").asArray()[2].asString() == "x\ny");
+	}
+
+	JsonSnapshot::write(element, File(path));
+	CHECK(JsonSnapshot::open(File(path)).getRoot().toElement() == element);
+
+	JsonSnapshot::write(JsonElement(42), File(path));
+	CHECK(JsonSnapshot::open(File(path)).getRoot().asInt() == 42);
+
+	std::filesystem::remove(path);
+}
+
+static void testInvalidFiles()
+{
+	const std::string path = tempPath("invalid.snap");
+
+	writeBytes(path, "");
+	CHECK_THROWS(JsonSnapshot::open(File(path)), JsonParserException);
+
+	writeBytes(path, "this is not a snapshot file, just some text that is long enough");
+	CHECK_THROWS(JsonSnapshot::open(File(path)), JsonParserException);
+
+	JsonSnapshot::write(JsonTape::parse(DOCUMENT), File(path));
+	const std::string valid = readBytes(path);
+	writeBytes(path, valid.substr(0, valid.size() - 5));
+	CHECK_THROWS(JsonSnapshot::open(File(path)), JsonParserException);
+
+	// Another format version.
+	std::string bytes = valid;
+	bytes[8] = static_cast<char>(JsonSnapshot::VERSION + 1);
+	writeBytes(path, bytes);
+	CHECK_THROWS(JsonSnapshot::open(File(path)), JsonParserException);
+
+	// A root container that does not span the whole tape.
+	bytes = valid;
+	bytes[48] = 0x01;
+	writeBytes(path, bytes);
+	CHECK_THROWS(JsonSnapshot::open(File(path)), JsonParserException);
+
+	std::filesystem::remove(path);
+}
+
+static void testCorruptedTapes()
+{
+	const std::string path = tempPath("corrupted.snap");
+	JsonSnapshot::write(JsonTape::parse(DOCUMENT), File(path));
+	const std::string valid = readBytes(path);
+
+	// The first tape word follows the 48-byte header.
+	const size_t wordsOffset = 48;
+
+	// A string whose offset points far past the string buffer.
+	{
+		std::string bytes = valid;
+		const size_t keyWord = wordsOffset + 8;
+		uint64_t word;
+		std::memcpy(&word, bytes.data() + keyWord, sizeof(word));
+		word |= uint64_t(0xFFFFFF) << 8;
+		std::memcpy(bytes.data() + keyWord, &word, sizeof(word));
+		writeBytes(path, bytes);
+		// Opening only checks the root; the walk in validate() finds the damage.
+		const JsonSnapshot snapshot = JsonSnapshot::open(File(path));
+		CHECK_THROWS(snapshot.validate(), JsonParserException);
+	}
+
+	// A nested container whose distance jumps past the end of the tape.
+	{
+		std::string bytes = valid;
+		const size_t arrayWord = wordsOffset + 2 * 8;
+		uint64_t word;
+		std::memcpy(&word, bytes.data() + arrayWord, sizeof(word));
+		word = (word & ~uint64_t(0xFFFFFFFF)) | 0x7FFFFFFF;
+		std::memcpy(bytes.data() + arrayWord, &word, sizeof(word));
+		writeBytes(path, bytes);
+		const JsonSnapshot snapshot = JsonSnapshot::open(File(path));
+		CHECK_THROWS(snapshot.validate(), JsonParserException);
+	}
+
+	// Random damage must either be rejected by open() or validate(), or stay readable.
+	std::mt19937_64 random(7);
+	for (int round = 0; round < 2000; ++round)
+	{
+		std::string bytes = valid;
+		for (int flip = 0; flip < 3; ++flip)
+		{
+			bytes[wordsOffset + random() % (bytes.size() - wordsOffset)] = static_cast<char>(random());
+		}
+		writeBytes(path, bytes);
+
+		try
+		{
+			const JsonSnapshot snapshot = JsonSnapshot::open(File(path));
+			snapshot.validate();
+			CHECK(visit(snapshot.getRoot()) > 0);
+		}
+		catch (const JsonParserException&)
+		{
+		}
+	}
+
+	std::filesystem::remove(path);
+}
+
+int main()
+{
+	testRoundTrip();
+	testInvalidFiles();
+	testCorruptedTapes();
+	return TEST_RESULT();
+}
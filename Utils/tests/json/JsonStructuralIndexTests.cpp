@@ -0,0 +1,143 @@
+#include "TestMakro.h"
+
+#include "json/JsonStructuralIndex.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace r_utils::json;
+using Implementation = JsonStructuralIndex::Implementation;
+
+static const Implementation IMPLEMENTATIONS[] = { Implementation::Scalar, Implementation::SSE42, Implementation::AVX2 };
+
+/** @brief Collects the positions of all windows. */
+static std::vector<uint32_t> positions(const std::string& input, size_t windowSize, Implementation implementation)
+{
+	JsonStructuralIndex index(input, windowSize, implementation);
+	std::vector<uint32_t> all = index.getPositions();
+	while (index.advance())
+	{
+		all.insert(all.end(), index.getPositions().begin(), index.getPositions().end());
+	}
+	return all;
+}
+
+/**
+ * @brief Checks that every kernel the CPU supports produces the positions of the scalar
+ * builder, both for the whole input and window by window.
+ */
+static bool matchesScalar(const std::string& input)
+{
+	const std::vector<uint32_t> expected = positions(input, 0, Implementation::Scalar);
+	for (Implementation implementation : IMPLEMENTATIONS)
+	{
+		if (!JsonStructuralIndex::isSupported(implementation))
+		{
+			continue;
+		}
+		for (size_t windowSize : { 0, 64, 128 })
+		{
+			if (positions(input, windowSize, implementation) != expected)
+			{
+				std::cerr << "kernel " << implementation << " with window " << windowSize << " differs on: " << input << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void testPositions()
+{
+	const std::vector<uint32_t> expected = { 0, 1, 4, 5, 6, 7, 8, 12, 13 };
+	for (Implementation implementation : IMPLEMENTATIONS)
+	{
+		if (JsonStructuralIndex::isSupported(implementation))
+		{
+			CHECK(positions(R"({"a":[1,true]})", 0, implementation) == expected);
+		}
+	}
+
+	CHECK(JsonStructuralIndex::isSupported(Implementation::Scalar));
+	CHECK(JsonStructuralIndex::isSupported(JsonStructuralIndex::getImplementation()));
+	CHECK(JsonStructuralIndex("").empty());
+	CHECK(JsonStructuralIndex(" \t\r\n ").empty());
+}
+
+static void testEscapes()
+{
+	CHECK(matchesScalar(R"(["a\"b", "c\\", "d\\\"e", "\\\\", 1])"));
+	CHECK(matchesScalar(R"({"k\"":"v\\\\\"x","n":[null]})"));
+
+	// Backslash runs of every length, ending just before a quote.
+	for (size_t run = 0; run < 70; ++run)
+	{
+		CHECK(matchesScalar("[\"" + std::string(run, '\\') + "\"]\"x\",1]"));
+	}
+}
+
+static void testBlockEdges()
+{
+	// Moves quotes, escapes and scalars across the 64-byte block boundary.
+	for (size_t pad = 0; pad < 130; ++pad)
+	{
+		const std::string padding(pad, ' ');
+		CHECK(matchesScalar(padding + R"(["x\"y",true,{"a":-1.5e3}])"));
+		CHECK(matchesScalar("[\"" + std::string(pad, 'a') + "\\\"\",12]"));
+		CHECK(matchesScalar("[\"" + std::string(pad, 'a') + "\\\\\",12]"));
+		CHECK(matchesScalar("[" + std::string(pad, '1') + ",\"" + padding + "\"]"));
+	}
+}
+
+static void testSingleQuotes()
+{
+	CHECK(matchesScalar("{'a':'b\"c','d':[1,'e\\'f']}"));
+	CHECK(matchesScalar(std::string(100, ' ') + "['x']"));
+	CHECK(matchesScalar("[\"it's\",1]"));
+	CHECK(matchesScalar("[\"" + std::string(70, 'a') + "\",'b']"));
+	// The kernel hands over inside a string; the scalar right after the closing quote is still indexed.
+	CHECK(matchesScalar("[\"" + std::string(70, 'a') + "\"x,'b']"));
+}
+
+static void testRandomInputs()
+{
+	static const char ALPHABET[] = "{}[]:,\"\\ \n'atrue1.-e";
+	uint32_t seed = 12345;
+	for (int round = 0; round < 2000; ++round)
+	{
+		std::string input;
+		const size_t length = 1 + round % 200;
+		for (size_t i = 0; i < length; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			input += ALPHABET[(seed >> 16) % (sizeof(ALPHABET) - 1)];
+		}
+		CHECK(matchesScalar(input));
+	}
+}
+
+static void testWindowBoundaries()
+{
+	// Strings, escapes and scalars that continue from one window into the next.
+	for (size_t pad = 56; pad < 72; ++pad)
+	{
+		const std::string padding(pad, ' ');
+		CHECK(matchesScalar(padding + R"(["a\"b\\",12345,true])"));
+		CHECK(matchesScalar("[\"" + std::string(pad, 'x') + "\\\\\\\"\",-1e5,null]"));
+	}
+
+	// A single quote in a later window switches the remaining windows to the scalar builder.
+	CHECK(matchesScalar("[" + std::string(150, ' ') + "'x',\"y\"," + std::string(100, ' ') + "1]"));
+}
+
+int main()
+{
+	testPositions();
+	testEscapes();
+	testBlockEdges();
+	testSingleQuotes();
+	testWindowBoundaries();
+	testRandomInputs();
+	return TEST_RESULT();
+}
@@ -0,0 +1,89 @@
+#include "TestMakro.h"
+
+#include "json/JsonTape.h"
+#include "json/JsonView.h"
+#include "json/JsonParser.h"
+
+#include "exception/json/JsonParserException.h"
+#include "exception/json/JsonObjectException.h"
+
+#include <string>
+
+using namespace r_utils::json;
+
+static void testObjectSize()
+{
+	const JsonTape tape = JsonTape::parse(R"({"a":1,"b":{"x":[1,2]},"c":3})");
+	const JsonObjectView root = tape.getRoot().asObject();
+
+	CHECK(root.size() == 3);
+	CHECK(!root.empty());
+	CHECK(root.get("b").asObject().size() == 1);
+	CHECK(root.get("b").asObject().get("x").asArray().size() == 2);
+	CHECK(JsonTape::parse("{}").getRoot().asObject().size() == 0);
+	CHECK(JsonTape::parse("{}").getRoot().asObject().empty());
+}
+
+static void testObjectLookup()
+{
+	const JsonTape tape = JsonTape::parse(R"({"name":"tape","count":2,"nested":{"flag":true},"none":null})");
+	const JsonObjectView root = tape.getRoot().asObject();
+
+	CHECK(root.get("name").asString() == "tape");
+	CHECK(root.get("count").asInt() == 2);
+	CHECK(root.get("nested").asObject().get("flag").asBoolean());
+	CHECK(root.get("none").isNull());
+	CHECK(root.contains("count"));
+	CHECK(!root.contains("missing"));
+	CHECK_THROWS(root.get("missing"), r_utils::exception::JsonObjectException);
+
+	size_t members = 0;
+	for (JsonObjectView::Member member : root)
+	{
+		CHECK(root.contains(member.key));
+		members++;
+	}
+	CHECK(members == root.size());
+}
+
+static void testRoundTrip()
+{
+	const std::string text = R"({"a":[1,2.5,"x\ny",true,false,null,[],{}],"b":{"c":"d"},"e":-7})";
+	const JsonElement element = JsonParser::parse(text);
+
+	CHECK(JsonTape::parse(text).getRoot().toElement() == element);
+	CHECK(JsonTape::fromElement(element).getRoot().toElement() == element);
+	CHECK(JsonTape::fromElement(element).getRoot().asObject().size() == 3);
+}
+
+static void testLargeContainers()
+{
+	std::string text = "{";
+	for (int i = 0; i < 1000; ++i)
+	{
+		if (i > 0) text += ',';
+		text += "\"k" + std::to_string(i) + "\":[" + std::to_string(i) + "]";
+	}
+	text += '}';
+
+	const JsonTape tape = JsonTape::parse(text);
+	const JsonObjectView root = tape.getRoot().asObject();
+	CHECK(root.size() == 1000);
+	CHECK(root.get("k999").asArray()[0].asInt() == 999);
+}
+
+static void testErrors()
+{
+	CHECK_THROWS(JsonTape::parse(R"({"a":1)"), r_utils::exception::JsonParserException);
+	CHECK_THROWS(JsonTape::parse("[1] 2"), r_utils::exception::JsonParserException);
+}
+
+int main()
+{
+	testObjectSize();
+	testObjectLookup();
+	testRoundTrip();
+	testLargeContainers();
+	testErrors();
+	return TEST_RESULT();
+}
@@ -0,0 +1,135 @@
+#include "TestMakro.h"
+
+#include "json/JsonWriter.h"
+#include "json/JsonParser.h"
+#include "file/File.h"
+
+#include "exception/json/JsonWriterException.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace r_utils::json;
+using r_utils::exception::JsonWriterException;
+
+static void testCompactOutput()
+{
+	std::ostringstream out;
+	{
+		JsonWriter writer(out);
+		writer.beginObject()
+			.key("name").value("writer")
+			.key("count").value(3)
+			.key("ratio").value(0.5)
+			.key("ok").value(true)
+			.key("none").value(nullptr)
+			.key("list").beginArray().value(std::string("a\"b")).value(std::string_view("c")).endArray()
+			.key("element").value(JsonParser::parse("[1,{}]"))
+			.endObject();
+		CHECK(writer.complete());
+	}
+	CHECK(out.str() == R"({"name":"writer","count":3,"ratio":0.5,"ok":true,"none":null,"list":["a\"b","c"],"element":[1,{}]})");
+}
+
+static void testPrettyOutput()
+{
+	std::ostringstream out;
+	{
+		JsonWriter writer(out, true);
+		writer.beginObject().key("a").beginArray().value(1).value(2).endArray().key("b").beginObject().endObject().endObject();
+	}
+	CHECK(JsonParser::parse(out.str()) == JsonParser::parse(R"({"a":[1,2],"b":{}})"));
+	CHECK(out.str().find('\n') != std::string::npos);
+}
+
+static void testLargeOutputIsFlushed()
+{
+	// Several times the internal buffer, so the writer drains it while writing.
+	std::ostringstream out;
+	{
+		JsonWriter writer(out);
+		writer.beginArray();
+		for (int i = 0; i < 50000; ++i)
+		{
+			writer.beginObject().key("id").value(i).key("text").value("some text to fill the buffer").endObject();
+		}
+		writer.endArray();
+	}
+	CHECK(out.str().size() > 3 * JsonWriter::BUFFER_SIZE);
+
+	const JsonElement parsed = JsonParser::parse(out.str());
+	CHECK(parsed.asArray().size() == 50000);
+	CHECK(parsed.asArray()[49999].asObject().get("id").asInt() == 49999);
+}
+
+static void testFileSink()
+{
+	const std::string path = (std::filesystem::temp_directory_path() / "r_utils_json_writer_test.json").string();
+	r_utils::io::File file(path);
+	{
+		JsonWriter writer(file);
+		writer.beginArray().value(1).value("two").endArray();
+	}
+	CHECK(JsonParser::parse(file) == JsonParser::parse(R"([1,"two"])"));
+	file.remove();
+}
+
+static void testIntegerTypes()
+{
+	const std::vector<int> list = { 1, 2, 3 };
+	const int64_t big = 9007199254740993;
+
+	std::ostringstream out;
+	{
+		JsonWriter writer(out);
+		writer.beginArray()
+			.value(list.size())
+			.value(big)
+			.value(std::numeric_limits<int64_t>::min())
+			.value(std::numeric_limits<uint64_t>::max())
+			.value(static_cast<short>(-5))
+			.value(static_cast<uint8_t>(200))
+			.value(7u)
+			.value(-8L)
+			.value(true)
+			.endArray();
+	}
+	CHECK(out.str() == "[3,9007199254740993,-9223372036854775808,18446744073709551615,-5,200,7,-8,true]");
+}
+
+static void testMisuse()
+{
+	std::ostringstream out;
+
+	JsonWriter missingKey(out);
+	missingKey.beginObject();
+	CHECK_THROWS(missingKey.value(1), JsonWriterException);
+
+	JsonWriter keyInArray(out);
+	keyInArray.beginArray();
+	CHECK_THROWS(keyInArray.key("a"), JsonWriterException);
+	CHECK_THROWS(keyInArray.endObject(), JsonWriterException);
+
+	JsonWriter twoValues(out);
+	twoValues.value(1);
+	CHECK(twoValues.complete());
+	CHECK_THROWS(twoValues.value(2), JsonWriterException);
+
+	JsonWriter unbalanced(out);
+	CHECK_THROWS(unbalanced.endArray(), JsonWriterException);
+}
+
+int main()
+{
+	testCompactOutput();
+	testPrettyOutput();
+	testLargeOutputIsFlushed();
+	testFileSink();
+	testIntegerTypes();
+	testMisuse();
+	return TEST_RESULT();
+}